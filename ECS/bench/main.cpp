@@ -0,0 +1,288 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+/*
+** ECS microbenchmarks, run without window or opengl context
+** Usage: ECS_bench [max entities number]
+** Each benchmark is run with 1k, 10k, 100k and 1M entities (up to the max) and reports
+** the time and the number of heap allocations per operation.
+** The create/destroy churn recycles each entity slot past the handle count limit
+** and checks that the stale handles are not resolved
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <ECS/System.hpp>
+#include <ECS/World.hpp>
+
+// Count the global heap allocations, the component allocators chunks included
+static std::atomic<uint64_t> allocationsNb(0);
+
+void*   operator new(std::size_t size)
+{
+    allocationsNb++;
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void    operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void    operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+START_COMPONENT(sBenchPositionComponent)
+    sComponent* clone() override final { return (new sBenchPositionComponent(*this)); }
+    void update(sComponent* component) override final { *this = *static_cast<sBenchPositionComponent*>(component); }
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+END_COMPONENT(sBenchPositionComponent)
+
+START_COMPONENT(sBenchVelocityComponent)
+    sComponent* clone() override final { return (new sBenchVelocityComponent(*this)); }
+    void update(sComponent* component) override final { *this = *static_cast<sBenchVelocityComponent*>(component); }
+    float x = 1.0f;
+    float y = 0.0f;
+    float z = 1.0f;
+END_COMPONENT(sBenchVelocityComponent)
+
+START_SYSTEM(BenchMoveSystem)
+    BenchMoveSystem()
+    {
+        addDependency<sBenchPositionComponent>();
+        addDependency<sBenchVelocityComponent>(eAccess::READ);
+    }
+
+    void update(EntityManager& em, float elapsedTime) override final
+    {
+        em.view<sBenchPositionComponent, sBenchVelocityComponent>().each([elapsedTime](Entity*,
+                                                                                    sBenchPositionComponent* position,
+                                                                                    sBenchVelocityComponent* velocity) {
+            position->x += velocity->x * elapsedTime;
+            position->y += velocity->y * elapsedTime;
+            position->z += velocity->z * elapsedTime;
+        });
+    }
+END_SYSTEM(BenchMoveSystem)
+
+// Prevent the compiler from removing the benchmarked loops
+static volatile float sink;
+
+static void printResult(const char* name, uint32_t entitiesNb, uint64_t opsNb, double seconds, uint64_t allocations)
+{
+    double nsPerOp = opsNb ? seconds * 1e9 / opsNb : 0.0;
+    double allocationsPerOp = opsNb ? (double)allocations / opsNb : 0.0;
+
+    std::printf("%-28s %9u %12.2f %12.3f\n", name, entitiesNb, nsPerOp, allocationsPerOp);
+}
+
+// Run the benchmark and print its time and allocations per operation
+static void bench(const char* name, uint32_t entitiesNb, uint64_t opsNb, const std::function<void ()>& run)
+{
+    uint64_t allocationsStart = allocationsNb;
+    auto start = std::chrono::steady_clock::now();
+
+    run();
+
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    printResult(name, entitiesNb, opsNb, duration.count(), allocationsNb - allocationsStart);
+}
+
+static void runBenchmarks(uint32_t entitiesNb)
+{
+    World world;
+    world.addSystem<BenchMoveSystem>();
+    EntityManager* em = world.getEntityManager();
+    BenchMoveSystem* moveSystem = world.getSystem<BenchMoveSystem>();
+    uint32_t enemyTag = EntityTags::getId("BenchEnemy");
+
+    std::vector<Entity::sHandle> handles;
+    handles.reserve(entitiesNb);
+
+    bench("create entity", entitiesNb, entitiesNb, [&]() {
+        for (uint32_t i = 0; i < entitiesNb; ++i)
+        {
+            Entity* entity = em->createEntity();
+            em->notifyEntityCreated(entity);
+            handles.push_back(entity->handle);
+        }
+    });
+
+    bench("add component", entitiesNb, entitiesNb * 2, [&]() {
+        for (const auto& handle: handles)
+        {
+            Entity* entity = em->getEntity(handle);
+            entity->addComponent(new sBenchPositionComponent());
+            entity->addComponent(new sBenchVelocityComponent());
+        }
+    });
+
+    bench("set tag", entitiesNb, entitiesNb / 2, [&]() {
+        for (uint32_t i = 0; i < entitiesNb; i += 2)
+        {
+            em->getEntity(handles[i])->setTag(enemyTag);
+        }
+    });
+
+    bench("getComponent", entitiesNb, entitiesNb, [&]() {
+        float sum = 0.0f;
+        for (const auto& handle: handles)
+        {
+            sum += em->getEntity(handle)->getComponent<sBenchPositionComponent>()->x;
+        }
+        sink = sum;
+    });
+
+    bench("getEntitiesByComponent", entitiesNb, entitiesNb, [&]() {
+        float sum = 0.0f;
+        for (Entity* entity: em->getEntitiesByComponent<sBenchPositionComponent>())
+        {
+            sum += entity->getComponent<sBenchPositionComponent>()->x;
+        }
+        sink = sum;
+    });
+
+    bench("view creation", entitiesNb, entitiesNb, [&]() {
+        sink = (float)em->view<sBenchPositionComponent, sBenchVelocityComponent>().getSize();
+    });
+
+    bench("view iteration", entitiesNb, entitiesNb, [&]() {
+        float sum = 0.0f;
+        em->view<sBenchPositionComponent, sBenchVelocityComponent>().each([&sum](Entity*,
+                                                                                sBenchPositionComponent* position,
+                                                                                sBenchVelocityComponent* velocity) {
+            sum += position->x + velocity->x;
+        });
+        sink = sum;
+    });
+
+    // Tags queries are done once per frame by the scripts, so measure the query and not the iteration
+    const uint32_t tagQueriesNb = 100000;
+    bench("tag query (id)", entitiesNb, tagQueriesNb, [&]() {
+        std::size_t size = 0;
+        for (uint32_t i = 0; i < tagQueriesNb; ++i)
+        {
+            size += em->getEntitiesByTag(enemyTag).size();
+        }
+        sink = (float)size;
+    });
+
+    bench("tag query (string)", entitiesNb, tagQueriesNb, [&]() {
+        std::size_t size = 0;
+        for (uint32_t i = 0; i < tagQueriesNb; ++i)
+        {
+            size += em->getEntitiesByTag("BenchEnemy").size();
+        }
+        sink = (float)size;
+    });
+
+    bench("system update", entitiesNb, entitiesNb, [&]() {
+        moveSystem->update(*em, 0.016f);
+    });
+
+    bench("remove component", entitiesNb, entitiesNb, [&]() {
+        for (const auto& handle: handles)
+        {
+            Entity* entity = em->getEntity(handle);
+            entity->removeComponent(entity->getComponent<sBenchVelocityComponent>());
+        }
+    });
+
+    bench("destroy entity", entitiesNb, entitiesNb, [&]() {
+        for (const auto& handle: handles)
+        {
+            em->destroyEntityRegister(handle);
+        }
+        em->flushCommands();
+    });
+}
+
+// Destroy the oldest entity and create a new one in its slot, the live entities number doesn't change
+static bool runChurnBenchmark(uint32_t entitiesNb, uint64_t cyclesNb)
+{
+    World world;
+    EntityManager* em = world.getEntityManager();
+    std::vector<Entity::sHandle> handles;
+    uint64_t staleResolvedNb = 0;
+    uint64_t countWrapsNb = 0;
+
+    handles.reserve(entitiesNb);
+    for (uint32_t i = 0; i < entitiesNb; ++i)
+    {
+        Entity* entity = em->createEntity();
+        entity->addComponent(new sBenchPositionComponent());
+        em->notifyEntityCreated(entity);
+        handles.push_back(entity->handle);
+    }
+
+    bench("create/destroy churn", entitiesNb, cyclesNb, [&]() {
+        for (uint64_t i = 0; i < cyclesNb; ++i)
+        {
+            Entity::sHandle& handle = handles[i % entitiesNb];
+            Entity::sHandle staleHandle = handle;
+
+            em->destroyEntity(staleHandle);
+
+            // The free list only holds the destroyed slot, the entity reuses it with the next count
+            Entity* entity = em->createEntity();
+            entity->addComponent(new sBenchPositionComponent());
+            em->notifyEntityCreated(entity);
+            handle = entity->handle;
+
+            if (em->getEntity(staleHandle) != nullptr)
+                staleResolvedNb++;
+            if (handle.index == staleHandle.index && handle.count < staleHandle.count)
+                countWrapsNb++;
+        }
+    });
+
+    if (staleResolvedNb != 0)
+    {
+        std::fprintf(stderr, "create/destroy churn: %llu stale handles resolved to an entity\n", (unsigned long long)staleResolvedNb);
+        return (false);
+    }
+    // Each slot has to be recycled more than ENTITY_HANDLE_MAX_COUNT times
+    if (countWrapsNb == 0)
+    {
+        std::fprintf(stderr, "create/destroy churn: the handle count limit was not reached\n");
+        return (false);
+    }
+    return (true);
+}
+
+int     main(int ac, char** av)
+{
+    uint32_t maxEntitiesNb = ac > 1 ? (uint32_t)std::strtoul(av[1], nullptr, 10) : 1000000;
+
+    std::printf("%-28s %9s %12s %12s\n", "benchmark", "entities", "ns/op", "allocs/op");
+    for (uint32_t entitiesNb = 1000; entitiesNb <= maxEntitiesNb && entitiesNb <= 1000000; entitiesNb *= 10)
+    {
+        runBenchmarks(entitiesNb);
+        std::printf("\n");
+    }
+
+    // 1000 live entities recycled 5000 times each
+    if (!runChurnBenchmark(1000, 5000000))
+    {
+        return (1);
+    }
+
+    return (0);
+}
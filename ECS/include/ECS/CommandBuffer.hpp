@@ -0,0 +1,109 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <ECS/Component.hh>
+#include <ECS/ComponentTypes.hpp>
+#include <ECS/Entity.hpp>
+
+class EntityManager;
+
+/*
+** Record the entities structural changes (create/destroy entities, add/remove components) during the systems update
+** and apply them at a sync point with flush, when no system iterates the entities.
+** Recording is thread safe.
+** The flush sorts the commands by entity and applies all the changes of an entity at once,
+** so the component pools, the views and the systems lists are updated once per entity.
+*/
+class CommandBuffer
+{
+public:
+    CommandBuffer();
+    ~CommandBuffer();
+
+    // The entity is created during the flush and init is called to add its components
+    void                                createEntity(const std::function<void (Entity* entity)>& init);
+    void                                destroyEntity(const Entity::sHandle& handle);
+    // The entity is destroyed but its components are detached and passed to recycle instead of being deleted
+    // recycle takes the components ownership, it can swap the vector
+    // The entity is not recycled if it's destroyed by another command
+    void                                recycleEntity(const Entity::sHandle& handle,
+                                                    const std::function<void (std::vector<sComponent*>& components)>& recycle);
+
+    // The buffer owns the component until it's added to the entity
+    // The component replaces the entity component of the same type if there is one
+    void                                addComponent(const Entity::sHandle& handle, sComponent* component);
+    void                                removeComponent(const Entity::sHandle& handle, uint32_t typeIndex);
+
+    template<typename ComponentType>
+    void                                removeComponent(const Entity::sHandle& handle)
+    {
+        removeComponent(handle, ComponentTypes::getIndex<ComponentType>());
+    }
+
+    // Apply the commands in the entity manager
+    // The commands recorded during the flush (by the scripts onDestroy...) are applied by the next flush
+    void                                flush(EntityManager& em);
+    // Discard the commands, the components not added are deleted
+    void                                clear();
+
+    bool                                empty();
+
+private:
+    struct sRecycledEntity
+    {
+        Entity::sHandle                 handle;
+        std::function<void (std::vector<sComponent*>& components)> recycle;
+    };
+
+    enum class eCommandType: uint8_t
+    {
+        ADD_COMPONENT,
+        REMOVE_COMPONENT,
+        DESTROY_ENTITY
+    };
+
+    struct sCommand
+    {
+        eCommandType                    type;
+        Entity::sHandle                 handle;
+        // Used by ADD_COMPONENT
+        sComponent*                     component;
+        // Used by ADD_COMPONENT and REMOVE_COMPONENT
+        uint32_t                        typeIndex;
+    };
+
+    // Final component of a type after the commands of an entity are applied
+    struct sComponentChange
+    {
+        uint32_t                        typeIndex;
+        sComponent*                     component;
+        // The component is added by the buffer
+        bool                            added;
+    };
+
+private:
+    // Apply the commands [begin, end[ which all have the same entity
+    void                                flushEntity(EntityManager& em, const std::vector<sCommand>& commands, uint32_t begin, uint32_t end);
+    static void                         deleteComponents(std::vector<sCommand>& commands);
+
+private:
+    std::vector<sCommand>               _commands;
+    std::vector<std::function<void (Entity* entity)> > _entitiesToCreate;
+    std::vector<sRecycledEntity>        _entitiesToRecycle;
+
+    std::mutex                          _mutex;
+
+    // Reused by the flush to avoid allocations
+    std::vector<sComponentChange>       _changes;
+    std::vector<sComponent*>            _removedComponents;
+    std::vector<sComponent*>            _addedComponents;
+    std::vector<sComponent*>            _recycledComponents;
+};
@@ -4,37 +4,75 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <ECS/ComponentAllocator.hpp>
+#include <ECS/ComponentTypes.hpp>
 #include <ECS/crc32.hh>
 
 class Entity;
 
 struct sComponent
 {
+friend Entity;
+
     sComponent() {}
-    sComponent(uint32_t id): id(id) {
-        enabled = true;
+    sComponent(uint32_t id, uint32_t typeIndex): id(id), typeIndex(typeIndex) {
+        _enabled = true;
     }
     virtual ~sComponent() {}
 
     virtual sComponent* clone() = 0;
     virtual void        update(sComponent* component) = 0;
+    // Reset the state of a recycled component (detached from its entity) to the prototype state
+    // Override it if update does not replace the whole state
+    virtual void        reset(sComponent* prototype)
+    {
+        update(prototype);
+        _enabled = prototype->_enabled;
+    }
+
+    bool                isEnabled() const { return (_enabled); }
+    // Also update the entity disabled components mask
+    void                setEnabled(bool enabled);
+
+    // Stamp the component with the current version of its entity manager (See EntityManager::nextVersion)
+    // Components are stamped when they are added to an entity, writers call it when they modify the component
+    void                markChanged();
+    uint32_t            getVersion() const { return (_version); }
+    bool                hasChangedSince(uint32_t version) const { return (_version > version); }
+
     uint32_t id;
+    // Dense index of the component type, see ComponentTypes
+    uint32_t typeIndex;
     Entity* entity{nullptr};
-    bool enabled;
+
+private:
+    bool _enabled;
+    uint32_t _version{0};
 };
 
+// Allocate the component with the allocator of its type (See ComponentAllocator)
+#define COMPONENT_ALLOCATOR(name) \
+        static void* operator new(std::size_t size) { \
+            return (ComponentAllocator::get<name>(#name).allocate(size)); \
+        } \
+        static void operator delete(void* ptr, std::size_t size) { \
+            ComponentAllocator::get<name>(#name).free(ptr, size); \
+        }
 
 #define START_COMPONENT(name) \
     struct name : sComponent { \
-        name(): sComponent(name::identifier) {} \
-        static constexpr unsigned int identifier = #name##_crc32;
+        name(): sComponent(name::identifier, ComponentTypes::getIndex<name>()) {} \
+        static constexpr unsigned int identifier = #name##_crc32; \
+        COMPONENT_ALLOCATOR(name)
 
 // TODO: Add optional parameter to START_COMPONENT
 #define START_COMPONENT_INHERIT(name, baseClass) \
     struct name : sComponent, public baseClass { \
-        name(): sComponent(name::identifier) {} \
-        static constexpr unsigned int identifier = #name##_crc32;
+        name(): sComponent(name::identifier, ComponentTypes::getIndex<name>()) {} \
+        static constexpr unsigned int identifier = #name##_crc32; \
+        COMPONENT_ALLOCATOR(name)
 
 #define END_COMPONENT(name) \
     };
@@ -0,0 +1,92 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#define COMPONENT_ALLOCATOR_CHUNK_SIZE 64
+
+/*
+** Allocate the components of one type by chunks (slabs) of COMPONENT_ALLOCATOR_CHUNK_SIZE components
+** The components of a type are close in memory and the freed slots are recycled with an intrusive free list,
+** so creating and destroying components does not go through the global heap.
+** START_COMPONENT declares the operator new/delete of the components with the allocator of their type,
+** so all the ways to create a component (new, clone, factories) use it.
+** Thread safe, components can be created by systems updated concurrently.
+*/
+class ComponentAllocator
+{
+public:
+    struct sStats
+    {
+        const char*                     name;
+        // Size of the component slots in bytes
+        std::size_t                     slotSize;
+        uint32_t                        chunksNb;
+        // Components currently allocated
+        uint32_t                        allocatedNb;
+        // Maximum number of components allocated at the same time
+        uint32_t                        peakAllocatedNb;
+        // Number of allocations since the start, recycledNb of them reused a freed slot
+        uint64_t                        allocationsNb;
+        uint64_t                        recycledNb;
+        // Allocations which did not fit in a slot (class derived from a component)
+        uint64_t                        heapAllocationsNb;
+    };
+
+public:
+    ComponentAllocator(const char* name, std::size_t size, uint32_t slotsPerChunk = COMPONENT_ALLOCATOR_CHUNK_SIZE);
+    ~ComponentAllocator();
+
+    void*                               allocate(std::size_t size);
+    void                                free(void* ptr, std::size_t size);
+
+    sStats                              getStats();
+
+    // The allocators are never destroyed, components can be deleted during the static destruction
+    template<typename ComponentType>
+    static ComponentAllocator&          get(const char* name)
+    {
+        static ComponentAllocator* allocator = new ComponentAllocator(name, sizeof(ComponentType));
+        return (*allocator);
+    }
+
+    // Stats of all the allocators created
+    static std::vector<sStats>          getAllStats();
+
+private:
+    // Intrusive free list stored in the free slots
+    struct sFreeSlot
+    {
+        sFreeSlot*                      next;
+    };
+
+private:
+    void                                allocateChunk();
+
+    static std::vector<ComponentAllocator*>& getAllocators();
+    static std::mutex&                  getAllocatorsMutex();
+
+private:
+    const char*                         _name;
+    std::size_t                         _size;
+    std::size_t                         _slotSize;
+    uint32_t                            _slotsPerChunk;
+
+    std::vector<std::unique_ptr<char[]> > _chunks;
+    sFreeSlot*                          _freeSlots;
+
+    std::mutex                          _mutex;
+
+    uint32_t                            _allocatedNb;
+    uint32_t                            _peakAllocatedNb;
+    uint64_t                            _allocationsNb;
+    uint64_t                            _recycledNb;
+    uint64_t                            _heapAllocationsNb;
+};
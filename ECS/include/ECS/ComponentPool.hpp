@@ -0,0 +1,66 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ECS/Component.hh>
+#include <ECS/Entity.hpp>
+
+/*
+** Dense storage of all the components of one type
+** Components and their owners are packed in two parallel arrays so systems can iterate them linearly,
+** and a sparse array indexed by the entity handle index gives O(1) entity -> component lookup.
+** Scripts and systems keep pointers on the components so they can't be moved,
+** the dense arrays store the components addresses which stay valid until the component is removed.
+** The components memory itself comes from the per-type slabs of ComponentAllocator.
+*/
+class ComponentPool
+{
+public:
+    ComponentPool(uint32_t typeIndex);
+    ~ComponentPool();
+
+    void                                add(Entity* entity, sComponent* component);
+    // Swap the removed component with the last one, the order of the components is not kept
+    bool                                remove(Entity* entity, sComponent* component);
+
+    sComponent*                         get(const Entity* entity) const
+    {
+        uint32_t index = entity->handle.index;
+
+        if (index >= _sparse.size() || _sparse[index] == 0)
+        {
+            return (nullptr);
+        }
+
+        return (_components[_sparse[index] - 1]);
+    }
+
+    bool                                has(const Entity* entity) const
+    {
+        uint32_t index = entity->handle.index;
+        return (index < _sparse.size() && _sparse[index] != 0);
+    }
+
+    void                                reserve(uint32_t componentsNb);
+
+    uint32_t                            getTypeIndex() const;
+    uint32_t                            getSize() const;
+
+    const std::vector<Entity*>&         getEntities() const;
+    const std::vector<sComponent*>&     getComponents() const;
+
+private:
+    uint32_t                            _typeIndex;
+
+    // Dense arrays, _entities[i] is the owner of _components[i]
+    std::vector<sComponent*>            _components;
+    std::vector<Entity*>                _entities;
+
+    // Entity handle index -> dense index + 1 (0 means the entity does not have the component)
+    std::vector<uint32_t>               _sparse;
+};
@@ -0,0 +1,62 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <mutex>
+
+#define COMPONENT_TYPES_MAX 64
+// Returned by findIndex if the component type is not registered
+#define COMPONENT_TYPE_NOT_FOUND 0xFFFFFFFF
+
+// One bit per component type, indexed by the component type index
+typedef std::bitset<COMPONENT_TYPES_MAX>    ComponentMask;
+
+/*
+** Give a dense index to each component type, so components can be stored in arrays
+** and entities/systems components can be represented as a ComponentMask
+** The index is given the first time a type is registered, the engine registers
+** all its component types at startup so the indices follow the components declaration order
+*/
+class ComponentTypes
+{
+public:
+    template<typename ComponentType>
+    static uint32_t                                 getIndex()
+    {
+        static const uint32_t index = registerType(ComponentType::identifier);
+        return (index);
+    }
+
+    template<typename... ComponentsTypes>
+    static ComponentMask                            getMask()
+    {
+        ComponentMask mask;
+        // Expand the parameter pack to set the bit of each component type
+        int expand[] = { 0, (mask.set(getIndex<ComponentsTypes>()), 0)... };
+        (void)expand;
+        return (mask);
+    }
+
+    // Return the index of an already registered type or register it
+    // Thread safe, systems updated concurrently can register types
+    static uint32_t                                 registerType(uint32_t componentHash);
+    // Return the index of a registered type or COMPONENT_TYPE_NOT_FOUND, without locking
+    static uint32_t                                 findIndex(uint32_t componentHash);
+    static uint32_t                                 getTypesNb();
+
+private:
+    static std::mutex&                              getMutex();
+
+private:
+    // Component type index -> component hash
+    // Zero-initialized before any dynamic initialization, the types can be registered during static initialization
+    static std::array<std::atomic<uint32_t>, COMPONENT_TYPES_MAX> _hashes;
+    // Published after the hash of the new type is written
+    static std::atomic<uint32_t>                    _typesNb;
+};
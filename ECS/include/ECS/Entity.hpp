@@ -9,6 +9,8 @@
 #include <functional>
 
 #include <ECS/Component.hh>
+#include <ECS/ComponentTypes.hpp>
+#include <ECS/EntityTags.hpp>
 
 #define POWER_TWO(x) (1 << (x))
 
@@ -23,6 +25,7 @@ class Entity
 {
 friend EntityManager;
 friend EntityPool;
+friend sComponent;
 
 public:
     struct sHandle
@@ -51,8 +54,8 @@ public:
     };
 
 private:
-    Entity() {}
-    Entity(EntityManager* em, uint32_t handle_): handle(handle_), _em(em) {}
+    Entity(): _tagId(ENTITY_TAG_NONE) {}
+    Entity(EntityManager* em, uint32_t handle_): handle(handle_), _tagId(ENTITY_TAG_NONE), _em(em) {}
 
 public:
     ~Entity();
@@ -61,16 +64,15 @@ public:
 
     void                            addComponent(sComponent* component);
 
-    template<typename componentType, typename... Args>
-    void                            addComponent(Args... args);
-
     template<typename componentType>
     componentType*                  getComponent() const
     {
-        return static_cast<componentType*>(getComponent(componentType::identifier));
+        return static_cast<componentType*>(getComponentByType(ComponentTypes::getIndex<componentType>()));
     }
 
     sComponent*                     getComponent(size_t componentHashCode) const;
+    // Get component with the component type index (See ComponentTypes)
+    sComponent*                     getComponentByType(uint32_t typeIndex) const;
     std::vector<sComponent*>&       getComponents();
     const std::vector<sComponent*>& getComponents() const;
 
@@ -82,11 +84,30 @@ public:
     template<typename componentType>
     bool                            hasComponent() const
     {
-        return (hasComponent(componentType::identifier));
+        return (_signature.test(ComponentTypes::getIndex<componentType>()));
     }
 
+    // Mask of the entity components types
+    const ComponentMask&            getSignature() const;
+    // Mask of the entity components which are not enabled
+    const ComponentMask&            getDisabledComponents() const;
+
+    // The main tag of the entity, saved with the level
+    // Setting it replaces the previous main tag in the entity tags
     void                            setTag(const std::string& tag);
+    void                            setTag(uint32_t tagId);
     const std::string&              getTag() const;
+    uint32_t                        getTagId() const;
+
+    // Additional tags, not saved with the level
+    void                            addTag(uint32_t tagId);
+    void                            removeTag(uint32_t tagId);
+
+    // Check the main tag and the additional tags
+    bool                            hasTag(uint32_t tagId) const;
+    bool                            hasTag(const std::string& tag) const;
+    // Mask of all the entity tags
+    const TagMask&                  getTags() const;
 
 public:
     sHandle                         handle;
@@ -94,8 +115,15 @@ public:
     bool                            _free;
 
 private:
-    std::string                     _tag;
+    uint32_t                        _tagId;
+    TagMask                         _tags;
     EntityManager*                  _em;
+
+    ComponentMask                   _signature;
+    ComponentMask                   _disabledComponents;
+
+    // Handle index of the next free entity in the EntityPool free list (0 if none)
+    uint32_t                        _nextFree;
 };
 
 
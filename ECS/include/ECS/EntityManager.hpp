@@ -4,69 +4,206 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 
+#include <ECS/CommandBuffer.hpp>
+#include <ECS/ComponentPool.hpp>
 #include <ECS/Entity.hpp>
+#include <ECS/EntityObservers.hpp>
 #include <ECS/EntityPool.hpp>
+#include <ECS/SparseSet.hpp>
+#include <ECS/View.hpp>
 
 class World;
 
 class EntityManager
 {
 friend Entity;
+friend CommandBuffer;
 
 public:
     EntityManager() = delete;
-    EntityManager(World& world);
+    EntityManager(World& world, uint32_t entitiesPerChunk = ENTITY_POOL_DEFAULT_CHUNK_SIZE);
     ~EntityManager();
 
     Entity*                                         createEntity(bool store = true);
+    // Reserve the entities storage before creating a lot of entities
+    void                                            reserveEntities(uint32_t entitiesNb);
 
     void                                            destroyEntity(const Entity::sHandle& entityHandle);
+    // Destroy the entity without deleting its components, they are detached and added to detachedComponents
+    void                                            destroyEntity(const Entity::sHandle& entityHandle, std::vector<sComponent*>& detachedComponents);
+    // Thread safe, the entity is destroyed by flushCommands
     void                                            destroyEntityRegister(const Entity::sHandle& entityHandle);
-    void                                            destroyEntities();
     void                                            destroyAllEntities();
 
-    std::vector<Entity*>&                           getEntities();
-    const std::vector<Entity*>&                     getEntitiesByTag(const std::string& tag);
-    Entity*                                         getEntityByTag(const std::string& tag);
+    // Record structural changes while the systems are updated, see CommandBuffer
+    CommandBuffer&                                  getCommandBuffer();
+    // Apply the recorded changes, must be called when no system is updated
+    // The observers triggered by the changes are called at the end of the flush
+    void                                            flushCommands();
+
+    // Call callback once when the entity is destroyed (See EntityObservers)
+    // The callback is called by flushCommands, or right after the destruction if the entity is destroyed outside of it
+    // The observer is dropped if the owner entity is destroyed before the observed entity
+    uint32_t                                        observeEntityDestroyed(const Entity::sHandle& handle,
+                                                                            const EntityObservers::Callback& callback,
+                                                                            const Entity::sHandle& owner = Entity::sHandle());
+    // Call callback once when the entity component is removed (and not replaced) or when the entity is destroyed
+    uint32_t                                        observeComponentRemoved(const Entity::sHandle& handle,
+                                                                            uint32_t typeIndex,
+                                                                            const EntityObservers::Callback& callback,
+                                                                            const Entity::sHandle& owner = Entity::sHandle());
+
+    template<typename ComponentType>
+    uint32_t                                        observeComponentRemoved(const Entity::sHandle& handle,
+                                                                            const EntityObservers::Callback& callback,
+                                                                            const Entity::sHandle& owner = Entity::sHandle())
+    {
+        return (observeComponentRemoved(handle, ComponentTypes::getIndex<ComponentType>(), callback, owner));
+    }
+
+    void                                            removeObserver(const Entity::sHandle& handle, uint32_t observerId);
+
+    const std::vector<Entity*>&                     getEntities() const;
+    // Entities having the tag as main or additional tag
+    const std::vector<Entity*>&                     getEntitiesByTag(uint32_t tagId) const;
+    Entity*                                         getEntityByTag(uint32_t tagId) const;
+    // Resolve the tag ID with EntityTags, prefer the ID overloads in the update loops
+    const std::vector<Entity*>&                     getEntitiesByTag(const std::string& tag) const;
+    Entity*                                         getEntityByTag(const std::string& tag) const;
 
     template<typename T>
     const std::vector<Entity*>&                     getEntitiesByComponent()
     {
-        return (_entitiesComponentGroups[T::identifier]);
+        return (getComponentPoolByType(ComponentTypes::getIndex<T>())->getEntities());
+    }
+
+    template<typename T>
+    ComponentPool*                                  getComponentPool()
+    {
+        return (getComponentPoolByType(ComponentTypes::getIndex<T>()));
+    }
+
+    // Return nullptr if the component type is not registered
+    ComponentPool*                                  getComponentPool(uint32_t componentHash) const;
+
+    // Get the cached view of the entities having all the ComponentsTypes components
+    // The view is created the first time and then updated when components are added or removed
+    template<typename... ComponentsTypes>
+    View<ComponentsTypes...>&                       view()
+    {
+        typedef View<ComponentsTypes...> ViewType;
+        uint32_t viewIdx = getViewIndex<ViewType>();
+
+        // Systems updated concurrently can create views
+        std::lock_guard<std::mutex> lock(_viewsMutex);
+
+        if (viewIdx >= _views.size())
+        {
+            _views.resize(viewIdx + 1);
+        }
+
+        if (!_views[viewIdx])
+        {
+            std::unique_ptr<ViewType> newView = std::make_unique<ViewType>();
+
+            // All the entities of the view have the first component type
+            typedef typename std::tuple_element<0, std::tuple<ComponentsTypes...> >::type FirstComponentType;
+            for (Entity* entity: getEntitiesByComponent<FirstComponentType>())
+            {
+                newView->onEntityNewComponent(entity);
+            }
+
+            _views[viewIdx] = std::move(newView);
+        }
+
+        return (static_cast<ViewType&>(*_views[viewIdx]));
     }
 
     Entity*                                         getEntity(const Entity::sHandle& handle) const;
 
+    // Version stamped on the changed components (See sComponent::markChanged)
+    uint32_t                                        getVersion() const;
+    // Close the current version and return it, the components changed from now on have a greater version
+    // A reader keeps the version returned by its previous call and processes the components changed since
+    uint32_t                                        nextVersion();
+
     // This function is not notified by the entity or the entity manager
     // It has to be called when an entity is created (all the components created too)
     void                                            notifyEntityCreated(Entity* entity);
+    // Notify the systems of all the created entities in one pass
+    void                                            notifyEntitiesCreated(const std::vector<Entity*>& entities);
+
+    // Add several components, of types the entity does not have, with a single update of the views and the systems
+    void                                            addComponents(Entity* entity, const std::vector<sComponent*>& components);
 
 private:
     void                                            notifyEntityNewComponent(Entity* entity, sComponent* component);
     void                                            notifyEntityRemovedComponent(Entity* entity, sComponent* component);
 
-    void                                            addEntityToTagGroup(Entity* entity, const std::string& name);
-    void                                            removeEntityFromTagGroup(Entity* entity, const std::string& name);
+    void                                            addEntityToTagGroup(Entity* entity, uint32_t tagId);
+    void                                            removeEntityFromTagGroup(Entity* entity, uint32_t tagId);
+
+    ComponentPool*                                  getComponentPoolByType(uint32_t typeIndex) const;
+
+    // _viewsMutex has to be locked
+    void                                            removeEntityFromViews(Entity* entity);
+
+    // The components are deleted if detachedComponents is nullptr
+    void                                            destroyEntity(const Entity::sHandle& entityHandle, std::vector<sComponent*>* detachedComponents);
 
-    void                                            addEntityToComponentGroup(Entity* entity, uint32_t componentHash);
-    void                                            removeEntityFromComponentGroup(Entity* entity, uint32_t componentHash);
+    // Call the triggered observers, unless the commands are being flushed
+    void                                            dispatchObservers();
+
+    // Remove and add several components of an entity with a single update of the views and the systems
+    // The removed components are deleted
+    void                                            applyComponentsChanges(Entity* entity,
+                                                                            const std::vector<sComponent*>& removedComponents,
+                                                                            const std::vector<sComponent*>& addedComponents);
+
+    // Give an index to each view type, used to store the views in _views
+    template<typename ViewType>
+    static uint32_t                                 getViewIndex()
+    {
+        static const uint32_t index = _viewTypesNb++;
+        return (index);
+    }
 
 private:
     // TODO: Replace Entity pointer with ID ?
-    std::vector<Entity*>                                    _entities;
+    // Indexed by entity handle index
+    SparseSet<Entity*>                                      _entities;
+
+    // Store entities by tag, indexed by tag ID (See EntityTags)
+    std::vector<SparseSet<Entity*> >                        _entitiesTagGroups;
+
+    // Store entities components by type, for O(1) lookup and linear iteration
+    // The vector is indexed by the component type index
+    // All the pools are created with the EntityManager so systems updated concurrently never modify the vector
+    std::vector<std::unique_ptr<ComponentPool> >            _componentPools;
+
+    // Views indexed by view type index
+    std::vector<std::unique_ptr<IView> >                    _views;
+    // Locked by view() and by every access to _views and to the component pools entities,
+    // a system updated concurrently can create a view
+    std::mutex                                              _viewsMutex;
+    static std::atomic<uint32_t>                            _viewTypesNb;
 
-    // Store entities by tag
-    std::unordered_map<std::string, std::vector<Entity*> >  _entitiesTagGroups;
+    CommandBuffer                                           _commandBuffer;
 
-    // Store entities by component
-    std::unordered_map<uint32_t, std::vector<Entity*> >     _entitiesComponentGroups;
+    EntityObservers                                         _observers;
+    // The observers triggered during the flush are dispatched at the end of the flush
+    bool                                                    _flushingCommands{false};
 
-    std::vector<Entity::sHandle>                            _entitiesToDestroy;
     World&                                                  _world;
+    // Components changes version, starts at 1 so new readers (version 0) see all the components as changed
+    std::atomic<uint32_t>                                   _version;
 
     std::unique_ptr<EntityPool>                             _entityPool;
 };
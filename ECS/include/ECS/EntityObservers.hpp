@@ -0,0 +1,79 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ECS/ComponentTypes.hpp>
+#include <ECS/Entity.hpp>
+
+// Type index of the observers of the entity destruction
+#define ENTITY_OBSERVER_DESTROYED COMPONENT_TYPES_MAX
+
+class EntityManager;
+
+/*
+** Callbacks subscribed to the destruction of an entity or to the removal of one of its components,
+** so the code keeping entities handles does not have to check every frame if the entities still exist.
+** The observers are triggered by the EntityManager and called in a batch by dispatch.
+** An observer is called once and is then removed.
+** An observer can have an owner entity, it's dropped if the owner is destroyed before the observer is called.
+** Subscribing is thread safe.
+*/
+class EntityObservers
+{
+public:
+    typedef std::function<void (const Entity::sHandle& handle)> Callback;
+
+public:
+    EntityObservers();
+    ~EntityObservers();
+
+    // Return the observer ID, never 0
+    uint32_t                            add(const Entity::sHandle& handle, uint32_t typeIndex, const Entity::sHandle& owner, const Callback& callback);
+    void                                remove(const Entity::sHandle& handle, uint32_t observerId);
+
+    // Trigger all the observers of the entity
+    void                                onEntityDestroyed(const Entity::sHandle& handle);
+    // Trigger the observers of the component type
+    void                                onComponentRemoved(const Entity::sHandle& handle, uint32_t typeIndex);
+
+    // Call the triggered observers
+    // The observers can destroy entities, the observers they trigger are called by the same dispatch
+    void                                dispatch(const EntityManager& em);
+    // Discard the observers without calling them
+    void                                clear();
+
+private:
+    struct sObserver
+    {
+        uint32_t                        id;
+        // Component type index or ENTITY_OBSERVER_DESTROYED
+        uint32_t                        typeIndex;
+        // Handle value 0 if the observer has no owner
+        Entity::sHandle                 owner;
+        Callback                        callback;
+    };
+
+    struct sTriggeredObserver
+    {
+        Entity::sHandle                 handle;
+        Entity::sHandle                 owner;
+        Callback                        callback;
+    };
+
+private:
+    // Observers by observed entity
+    std::unordered_map<Entity::sHandle, std::vector<sObserver> > _observers;
+    std::vector<sTriggeredObserver>     _triggeredObservers;
+
+    uint32_t                            _observersIds{0};
+
+    std::mutex                          _mutex;
+};
@@ -6,24 +6,29 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
+
+#define ENTITY_POOL_DEFAULT_CHUNK_SIZE 100
 
 class Entity;
 class EntityManager;
 
+/*
+** Allocate entities by chunks
+** The free entities of all the chunks are linked in one intrusive FIFO list (see Entity::_nextFree),
+** so allocate and free are O(1). Freed entities are reused last to delay the handle count wrapping.
+*/
 class EntityPool {
 private:
     struct Chunk {
         Entity* entities;
 
-        // Store indices of free entities
-        std::vector<uint32_t> freeEntities;
-
         // Chunk idx
         uint32_t idx;
     };
 
 public:
-    EntityPool(EntityManager* em, uint32_t entitiesPerChunk);
+    EntityPool(EntityManager* em, uint32_t entitiesPerChunk = ENTITY_POOL_DEFAULT_CHUNK_SIZE);
     ~EntityPool();
 
     Entity*                             allocate();
@@ -31,9 +36,22 @@ public:
 
     Entity*                             getEntity(const Entity::sHandle& handle);
 
+    uint32_t                            getEntitiesPerChunk() const;
+    uint32_t                            getChunksNb() const;
+
+private:
+    void                                allocateChunk();
+
+    // Get entity with handle index without checking the handle count
+    Entity*                             getEntityByIndex(uint32_t index) const;
+
 private:
     EntityManager*                      _em;
 
     uint32_t                            _entitiesPerChunk;
     std::vector<std::unique_ptr<Chunk> > _chunks;
+
+    // Handle indices of the first and last free entities (0 if there is no free entity)
+    uint32_t                            _freeHead;
+    uint32_t                            _freeTail;
 };
@@ -0,0 +1,45 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#define ENTITY_TAGS_MAX 128
+// ID of the empty tag, entities without tag are not stored in a tag group
+#define ENTITY_TAG_NONE 0
+
+// One bit per tag, indexed by the tag ID
+typedef std::bitset<ENTITY_TAGS_MAX>    TagMask;
+
+/*
+** Intern the entities tags: each tag name is given a dense ID the first time it is used,
+** so entities can be compared and grouped by tag without hashing or comparing strings.
+** Resolve the IDs once (when a level or a script is loaded) and use the ID overloads in the update loops
+*/
+class EntityTags
+{
+public:
+    // Return the ID of an already registered tag or register it
+    // Return ENTITY_TAG_NONE if ENTITY_TAGS_MAX tags are already registered
+    // Thread safe, scripts updated concurrently can resolve tags
+    static uint32_t                                     getId(const std::string& tag);
+    // Return the ID of a registered tag, or ENTITY_TAG_NONE (no entity has this tag) without registering it
+    // Used by the queries, so looking for an unknown tag doesn't use a tag ID
+    static uint32_t                                     find(const std::string& tag);
+    static const std::string&                           getName(uint32_t tagId);
+    static uint32_t                                     getTagsNb();
+
+private:
+    // Tag name -> tag ID
+    static std::unordered_map<std::string, uint32_t>&   getIds();
+    // Indexed by tag ID, a deque so the names references are not invalidated when a tag is registered
+    static std::deque<std::string>&                     getNames();
+    static std::mutex&                                  getMutex();
+};
@@ -0,0 +1,146 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+** Set of values identified by a uint32_t key (usually the entity handle index)
+** The values are packed in a dense array so they can be iterated linearly,
+** and a sparse array indexed by the key gives O(1) insert, remove and contains.
+*/
+template<typename T>
+class SparseSet
+{
+public:
+    SparseSet() {}
+    ~SparseSet() {}
+
+    // Return false if the key is already in the set
+    bool                                insert(uint32_t key, const T& value)
+    {
+        if (key >= _sparse.size())
+        {
+            _sparse.resize(key + 1, 0);
+        }
+
+        if (_sparse[key] != 0)
+        {
+            return (false);
+        }
+
+        _dense.push_back(value);
+        _keys.push_back(key);
+        _sparse[key] = (uint32_t)_dense.size();
+        return (true);
+    }
+
+    // Swap the removed value with the last one, the order of the values is not kept
+    bool                                remove(uint32_t key)
+    {
+        if (!contains(key))
+        {
+            return (false);
+        }
+
+        uint32_t denseIdx = _sparse[key] - 1;
+        uint32_t lastIdx = (uint32_t)_dense.size() - 1;
+        if (denseIdx != lastIdx)
+        {
+            _dense[denseIdx] = _dense[lastIdx];
+            _keys[denseIdx] = _keys[lastIdx];
+            _sparse[_keys[denseIdx]] = denseIdx + 1;
+        }
+
+        _dense.pop_back();
+        _keys.pop_back();
+        _sparse[key] = 0;
+        return (true);
+    }
+
+    // Remove the value and keep the order of the other values
+    // O(n), only use it when the order matters
+    bool                                removeOrdered(uint32_t key)
+    {
+        if (!contains(key))
+        {
+            return (false);
+        }
+
+        uint32_t denseIdx = _sparse[key] - 1;
+        _dense.erase(_dense.begin() + denseIdx);
+        _keys.erase(_keys.begin() + denseIdx);
+        for (uint32_t i = denseIdx; i < _keys.size(); ++i)
+        {
+            _sparse[_keys[i]] = i + 1;
+        }
+
+        _sparse[key] = 0;
+        return (true);
+    }
+
+    bool                                contains(uint32_t key) const
+    {
+        return (key < _sparse.size() && _sparse[key] != 0);
+    }
+
+    // The key has to be in the set
+    T&                                  get(uint32_t key)
+    {
+        return (_dense[_sparse[key] - 1]);
+    }
+
+    void                                clear()
+    {
+        for (uint32_t key: _keys)
+        {
+            _sparse[key] = 0;
+        }
+        _dense.clear();
+        _keys.clear();
+    }
+
+    void                                reserve(uint32_t valuesNb)
+    {
+        _dense.reserve(valuesNb);
+        _keys.reserve(valuesNb);
+    }
+
+    std::size_t                         size() const
+    {
+        return (_dense.size());
+    }
+
+    bool                                empty() const
+    {
+        return (_dense.empty());
+    }
+
+    T&                                  operator[](std::size_t idx)
+    {
+        return (_dense[idx]);
+    }
+
+    const T&                            operator[](std::size_t idx) const
+    {
+        return (_dense[idx]);
+    }
+
+    const std::vector<T>&               getDense() const
+    {
+        return (_dense);
+    }
+
+private:
+    std::vector<T>                      _dense;
+
+    // _keys[i] is the key of _dense[i]
+    std::vector<uint32_t>               _keys;
+
+    // Key -> dense index + 1 (0 means the key is not in the set)
+    std::vector<uint32_t>               _sparse;
+};
@@ -9,10 +9,23 @@
 
 #include <ECS/EntityManager.hpp>
 #include <ECS/Component.hh>
+#include <ECS/SparseSet.hpp>
+#include <ECS/WorkerPool.hpp>
 #include <ECS/crc32.hh>
 
+// Default number of entities processed by a task of System::parallelForEach
+#define SYSTEM_PARALLEL_GRAIN_SIZE 64
+
 class System
 {
+public:
+    // How a system accesses a component type, used by the SystemScheduler to run systems concurrently
+    enum class eAccess: uint8_t
+    {
+        READ = 0,
+        WRITE = 1
+    };
+
 public:
     System(uint32_t id);
     virtual ~System();
@@ -21,14 +34,96 @@ public:
     virtual bool                        init();
     void                                forEachEntity(EntityManager& em, std::function<void (Entity* entity)> callback);
 
+    // Same as forEachEntity but the entities are split in chunks of grainSize entities processed concurrently
+    // The callback must only access the components of the entity it is called with
+    void                                parallelForEach(EntityManager& em, const std::function<void (Entity* entity)>& callback,
+                                                        uint32_t grainSize = SYSTEM_PARALLEL_GRAIN_SIZE);
+
+    // parallelForEach with a ScratchType instance per thread, given to the callback to accumulate results
+    // without synchronization. reduce is called on each scratch on the calling thread once all the entities are processed
+    template<typename ScratchType>
+    void                                parallelForEach(EntityManager& em,
+                                                        const std::function<void (Entity* entity, ScratchType& scratch)>& callback,
+                                                        const std::function<void (ScratchType& scratch)>& reduce,
+                                                        uint32_t grainSize = SYSTEM_PARALLEL_GRAIN_SIZE)
+    {
+        std::vector<ScratchType> scratches(WorkerPool::getThreadIndicesNb());
+
+        WorkerPool::getInstance()->parallelFor((uint32_t)_entities.size(), grainSize, [&](uint32_t begin, uint32_t end) {
+            ScratchType& scratch = scratches[WorkerPool::getThreadIndex()];
+
+            for (uint32_t idx = begin; idx < end; ++idx)
+            {
+                Entity* entity = em.getEntity(_entities[idx]);
+                if (!entity || hasDependencyDisabled(entity))
+                    continue;
+
+                callback(entity, scratch);
+            }
+        });
+
+        for (auto& scratch: scratches)
+        {
+            reduce(scratch);
+        }
+    }
+
+    // The entities need the component to be in the system
+    // The component is considered written unless the system only reads it
+    template<typename ComponentType>
+    void                                addDependency(eAccess access = eAccess::WRITE)
+    {
+        _dependencies.set(ComponentTypes::getIndex<ComponentType>());
+        addAccess<ComponentType>(access);
+    }
+
+    // Declare a component the system accesses without depending on it
     template<typename ComponentType>
-    void                                addDependency()
+    void                                addAccess(eAccess access)
     {
-        _components.push_back(ComponentType::identifier);
+        uint32_t typeIndex = ComponentTypes::getIndex<ComponentType>();
+
+        if (access == eAccess::WRITE)
+        {
+            _writeComponents.set(typeIndex);
+        }
+        else
+        {
+            _readComponents.set(typeIndex);
+        }
     }
 
     uint32_t                            getId() const;
     uint32_t                            getEntitiesNb() const;
+    bool                                hasEntity(const Entity::sHandle& handle) const;
+
+    // Mask of the components types the entities need to be in the system
+    const ComponentMask&                getDependencies() const;
+    const ComponentMask&                getReadComponents() const;
+    const ComponentMask&                getWriteComponents() const;
+
+    // An exclusive system runs alone on the thread calling the SystemScheduler
+    // Systems with global side effects (rendering, scripts, input...) have to be exclusive
+    bool                                isExclusive() const;
+    void                                setExclusive(bool exclusive);
+
+    // The system runs on the thread calling the SystemScheduler but can run concurrently with other systems
+    // Used by systems which can make opengl calls (model loading...)
+    bool                                isMainThreadOnly() const;
+    void                                setMainThreadOnly(bool mainThreadOnly);
+
+    // The system only accesses the components of its own entities
+    // Two such systems can run concurrently if they don't have any entity in common, even if their accesses conflict
+    bool                                isAccessingOwnEntitiesOnly() const;
+    void                                setAccessOwnEntitiesOnly(bool ownEntitiesOnly);
+
+    // The system simulates the world at a fixed time step, it's updated by World::fixedUpdate instead of World::update
+    // (physics, collisions...), so its behaviour doesn't depend on the frame rate
+    bool                                isFixedUpdate() const;
+    void                                setFixedUpdate(bool fixedUpdate);
+
+    // Check if the system can't run concurrently with another system
+    bool                                conflictsWith(const System& system) const;
 
     bool                                hasDependency(sComponent* component) const;
     bool                                hasDependencyDisabled(Entity* entity) const;
@@ -41,11 +136,29 @@ public:
 
     virtual const char*                 getName() const = 0;
 
+private:
+    // Remove the entity from the system list, return false if it was not in the list
+    bool                                removeEntity(Entity* entity);
+
 protected:
-    // Store components hashs
-    std::vector<uint32_t>           _components;
+    // Mask of the components types the entities need to be in the system
+    ComponentMask                   _dependencies;
+
+    // Masks of the components types the system reads and writes
+    ComponentMask                   _readComponents;
+    ComponentMask                   _writeComponents;
+
+    bool                            _exclusive;
+    bool                            _mainThreadOnly;
+    bool                            _accessOwnEntitiesOnly;
+    bool                            _fixedUpdate;
+
+    // Entities handles indexed by entity handle index
+    SparseSet<Entity::sHandle>      _entities;
 
-    std::vector<Entity::sHandle>           _entities;
+    // Keep the entities in the order they entered the system when one is removed
+    // Removal is O(n) instead of O(1), only set it if the system relies on the order
+    bool                            _keepEntitiesOrder;
 
     uint32_t                        _id;
 };
@@ -0,0 +1,74 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ECS/System.hpp>
+#include <ECS/WorkerPool.hpp>
+
+/*
+** Update the systems of a World, running the systems which don't conflict concurrently
+** Each frame, a dependency graph is built from the systems declared accesses (see System::conflictsWith):
+** a system waits for all the previous systems it conflicts with, so the result is the same as a sequential update.
+** Exclusive systems are barriers, they run alone on the calling thread.
+** Main thread only systems run on the calling thread, concurrently with the systems running on the workers.
+** Systems running concurrently must not create entities or add/remove components,
+** they record them in the EntityManager command buffer (see CommandBuffer), applied after the update.
+*/
+class SystemScheduler
+{
+public:
+    SystemScheduler(WorkerPool* workerPool = nullptr);
+    ~SystemScheduler();
+
+    // Only update the systems which are fixed update systems if fixedUpdate is true, or the others (See System::isFixedUpdate)
+    void                                update(std::vector<std::unique_ptr<System> >& systems, EntityManager& em, float elapsedTime,
+                                                bool fixedUpdate = false);
+
+    // Time spent in each system update during the last update, in seconds
+    // Indexed like the systems vector
+    const std::vector<float>&           getSystemsTimes() const;
+
+    // Disable parallelism, all systems are updated sequentially on the calling thread
+    void                                setParallel(bool parallel);
+    bool                                isParallel() const;
+
+private:
+    struct sNode
+    {
+        System*                         system;
+        // Index in the systems vector
+        uint32_t                        systemIdx;
+
+        // Nodes waiting for this one
+        std::vector<uint32_t>           successors;
+        // Previous nodes not finished yet
+        std::atomic<uint32_t>           remainingPredecessors;
+    };
+
+private:
+    // Update the systems _updatedSystems[begin, end[ which are all not exclusive
+    void                                updateGroup(std::vector<std::unique_ptr<System> >& systems, uint32_t begin, uint32_t end,
+                                                    EntityManager& em, float elapsedTime);
+    void                                submitNode(TaskGroup& group, uint32_t nodeIdx, EntityManager& em, float elapsedTime);
+    void                                runNode(TaskGroup& group, uint32_t nodeIdx, EntityManager& em, float elapsedTime);
+    void                                updateSystem(System* system, uint32_t systemIdx, EntityManager& em, float elapsedTime);
+
+private:
+    WorkerPool*                         _workerPool;
+    bool                                _parallel;
+
+    std::vector<float>                  _systemsTimes;
+    // Indices of the systems updated by the current update
+    std::vector<uint32_t>               _updatedSystems;
+
+    // Graph of the group of systems being updated
+    std::vector<std::unique_ptr<sNode> > _nodes;
+    std::thread::id                     _mainThread;
+};
@@ -0,0 +1,141 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <ECS/ComponentTypes.hpp>
+#include <ECS/Entity.hpp>
+#include <ECS/SparseSet.hpp>
+
+/*
+** Base class of the views so the EntityManager can store and update them without knowing the components types
+*/
+class IView
+{
+public:
+    IView(const ComponentMask& mask): _mask(mask) {}
+    virtual ~IView() {}
+
+    const ComponentMask&                getMask() const
+    {
+        return (_mask);
+    }
+
+    // Called when an entity got a new component of the view
+    virtual void                        onEntityNewComponent(Entity* entity) = 0;
+    // Called when an entity lost a component of the view or is destroyed
+    virtual void                        onEntityRemoved(Entity* entity) = 0;
+
+    virtual uint32_t                    getSize() const = 0;
+
+protected:
+    ComponentMask                       _mask;
+};
+
+/*
+** Cached list of the entities which have all the ComponentsTypes components
+** The components pointers are resolved when the entity enters the view, so iterating
+** the view does not need any component lookup.
+** The view is created with EntityManager::view and is updated by the EntityManager
+** each time a component is added or removed.
+*/
+template<typename... ComponentsTypes>
+class View: public IView
+{
+public:
+    struct sEntry
+    {
+        Entity*                             entity;
+        std::tuple<ComponentsTypes*...>     components;
+    };
+
+public:
+    View(): IView(ComponentTypes::getMask<ComponentsTypes...>()) {}
+    virtual ~View() {}
+
+    // Call callback(Entity*, ComponentsTypes*...) for each entity of the view
+    // Entities with one of the view components disabled are skipped
+    template<typename Callback>
+    void                                each(Callback callback)
+    {
+        // Don't use iterators, the callback can add entities to the view
+        for (uint32_t i = 0; i < _entries.size(); ++i)
+        {
+            const sEntry& entry = _entries[i];
+
+            if ((entry.entity->getDisabledComponents() & _mask).any())
+                continue;
+
+            call(callback, entry, std::index_sequence_for<ComponentsTypes...>());
+        }
+    }
+
+    const std::vector<sEntry>&          getEntries() const
+    {
+        return (_entries.getDense());
+    }
+
+    uint32_t                            getSize() const override final
+    {
+        return ((uint32_t)_entries.size());
+    }
+
+    // Call callback only on the entities which have one of the view components changed since version
+    // (See sComponent::markChanged)
+    template<typename Callback>
+    void                                eachChangedSince(uint32_t version, Callback callback)
+    {
+        for (const auto& entry: _entries.getDense())
+        {
+            if (hasChangedSince(entry, version, std::index_sequence_for<ComponentsTypes...>()) &&
+                (entry.entity->getDisabledComponents() & _mask).none())
+            {
+                call(callback, entry, std::index_sequence_for<ComponentsTypes...>());
+            }
+        }
+    }
+
+    void                                onEntityNewComponent(Entity* entity) override final
+    {
+        uint32_t index = entity->handle.index;
+
+        if ((entity->getSignature() & _mask) != _mask || _entries.contains(index))
+        {
+            return;
+        }
+
+        _entries.insert(index, {entity, std::make_tuple(entity->getComponent<ComponentsTypes>()...)});
+    }
+
+    void                                onEntityRemoved(Entity* entity) override final
+    {
+        _entries.remove(entity->handle.index);
+    }
+
+private:
+    template<typename Callback, std::size_t... Indices>
+    void                                call(Callback& callback, const sEntry& entry, std::index_sequence<Indices...>)
+    {
+        callback(entry.entity, std::get<Indices>(entry.components)...);
+    }
+
+    template<std::size_t... Indices>
+    static bool                         hasChangedSince(const sEntry& entry, uint32_t version, std::index_sequence<Indices...>)
+    {
+        bool changed = false;
+        // Expand the components pack, C++14 has no fold expressions
+        (void)std::initializer_list<int>{(changed = changed || std::get<Indices>(entry.components)->hasChangedSince(version), 0)...};
+        return (changed);
+    }
+
+private:
+    // Entries indexed by entity handle index
+    SparseSet<sEntry>                   _entries;
+};
@@ -0,0 +1,103 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+** Tasks submitted together and waited together with WorkerPool::wait
+*/
+class TaskGroup
+{
+friend class WorkerPool;
+
+public:
+    TaskGroup(): _pendingTasksNb(0) {}
+    ~TaskGroup() {}
+
+private:
+    // Tasks submitted and not finished, protected by the WorkerPool mutex
+    uint32_t                                _pendingTasksNb;
+
+    // First exception thrown by a task of the group, rethrown by WorkerPool::wait
+    std::exception_ptr                      _exception;
+};
+
+/*
+** Fixed number of threads executing tasks from a shared queue
+** The thread waiting for a TaskGroup executes queued tasks too, so a pool without worker
+** (single core machine) still executes everything on the calling thread.
+*/
+class WorkerPool
+{
+public:
+    // workersNb does not include the calling thread which also executes tasks when waiting
+    WorkerPool(uint32_t workersNb);
+    ~WorkerPool();
+
+    // Shared pool with one worker less than the number of hardware threads
+    static WorkerPool*                      getInstance();
+
+    // Tasks can submit other tasks in the same group
+    // If thread is set, the task is only executed by this thread when it waits for the group
+    void                                    submit(TaskGroup& group, const std::function<void()>& task,
+                                                    std::thread::id thread = std::thread::id());
+    // Wait until all the tasks of the group are done and rethrow the first exception thrown by a task
+    // A task can wait for another group (parallelFor in a system scheduled on the pool): the waiting thread
+    // executes queued tasks of any group meanwhile, so the nested wait can return after unrelated tasks
+    void                                    wait(TaskGroup& group);
+
+    // Split [0, count[ in ranges of grainSize elements and call callback(begin, end) on each range concurrently
+    // The calling thread processes the first range and returns when all the ranges are done
+    void                                    parallelFor(uint32_t count, uint32_t grainSize,
+                                                        const std::function<void (uint32_t begin, uint32_t end)>& callback);
+
+    uint32_t                                getWorkersNb() const;
+
+    // Index of the current thread, unique for the workers of all the pools, used to index per thread data
+    // The threads which are not workers (the main thread) have the index 0
+    static uint32_t                         getThreadIndex();
+    // Number of thread indices given, per thread data indexed with getThreadIndex needs this size
+    static uint32_t                         getThreadIndicesNb();
+
+private:
+    struct sTask
+    {
+        std::function<void()>               function;
+        TaskGroup*                          group;
+        // Thread which has to execute the task, any thread if not set
+        std::thread::id                     thread;
+    };
+
+private:
+    void                                    workerLoop(uint32_t threadIndex);
+    // Find a task the current thread can execute
+    std::deque<sTask>::iterator             findTask();
+    // Execute the task and remove it from the queue, the lock is released during the execution
+    void                                    runTask(std::unique_lock<std::mutex>& lock, std::deque<sTask>::iterator taskIt);
+
+private:
+    static std::unique_ptr<WorkerPool>      _instance;
+    static thread_local uint32_t            _threadIndex;
+    static std::atomic<uint32_t>            _threadIndicesNb;
+
+    std::vector<std::thread>                _workers;
+    std::deque<sTask>                       _tasks;
+
+    std::mutex                              _mutex;
+    // Notified when a task is queued, when a task is done and when the pool is stopped
+    std::condition_variable                 _condition;
+
+    bool                                    _stop;
+};
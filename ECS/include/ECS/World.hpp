@@ -4,25 +4,35 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 #include <memory>
 
 #include <ECS/EntityManager.hpp>
 #include <ECS/System.hpp>
+#include <ECS/SystemScheduler.hpp>
 
 class World
 {
 public:
-    World();
+    World(uint32_t entitiesPerChunk = ENTITY_POOL_DEFAULT_CHUNK_SIZE);
     ~World();
 
     EntityManager*                          getEntityManager();
     std::vector<std::unique_ptr<System> >&  getSystems();
+    bool                                    hasFixedUpdateSystems() const;
+    SystemScheduler&                        getScheduler();
+
+    // Update the systems with the scheduler, except the fixed update systems
+    void                    update(float elapsedTime);
+    // Update the fixed update systems (See System::isFixedUpdate), fixedTimeStep is the same for all the calls
+    void                    fixedUpdate(float fixedTimeStep);
 
     template<typename T, typename... Args>
     void                    addSystem(Args... args)
     {
         std::unique_ptr<System> system_ = std::make_unique<T>(args...);
+        indexSystem(system_.get());
         _systems.push_back(std::move(system_));
     }
 
@@ -44,10 +54,32 @@ public:
 
     void                        notifyEntityNewComponent(Entity* entity, sComponent* component);
     void                        notifyEntityRemovedComponent(Entity* entity, sComponent* component);
+    // Notify the systems once for all the components changes of an entity, see CommandBuffer
+    void                        notifyEntityComponentsChanged(Entity* entity,
+                                                            const std::vector<sComponent*>& removedComponents,
+                                                            const std::vector<sComponent*>& addedComponents);
     void                        notifyEntityCreated(Entity* entity);
+    void                        notifyEntitiesCreated(const std::vector<Entity*>& entities);
     void                        notifyEntityDeleted(Entity* entity);
 
+private:
+    // The system dependencies have to be declared in its constructor
+    void                        indexSystem(System* system_);
+    // Call callback on each system having the entity
+    void                        forEachEntitySystem(Entity* entity, const std::function<void (System* system_)>& callback);
+
 private:
     std::unique_ptr<EntityManager>          _entityManager;
     std::vector<std::unique_ptr<System> >    _systems;
+
+    // Systems depending on each component type, indexed by component type index
+    // Only these systems are notified when a component of the type is added or removed
+    std::vector<std::vector<System*> >      _systemsByDependency;
+    // Systems indexed by the type index of their first dependency
+    // A system having an entity is in the list of one of the entity components types, so it is found without
+    // iterating all the systems, and System::hasEntity tells if the entity is in it
+    std::vector<std::vector<System*> >      _systemsByFirstDependency;
+    // Types which have systems in _systemsByFirstDependency
+    ComponentMask                           _firstDependencies;
+    SystemScheduler                         _scheduler;
 };
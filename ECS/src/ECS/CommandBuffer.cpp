@@ -0,0 +1,191 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+
+#include <ECS/EntityManager.hpp>
+
+#include <ECS/CommandBuffer.hpp>
+
+CommandBuffer::CommandBuffer() {}
+
+CommandBuffer::~CommandBuffer()
+{
+    clear();
+}
+
+void    CommandBuffer::createEntity(const std::function<void (Entity* entity)>& init)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entitiesToCreate.push_back(init);
+}
+
+void    CommandBuffer::destroyEntity(const Entity::sHandle& handle)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _commands.push_back({eCommandType::DESTROY_ENTITY, handle, nullptr, 0});
+}
+
+void    CommandBuffer::recycleEntity(const Entity::sHandle& handle,
+                                        const std::function<void (std::vector<sComponent*>& components)>& recycle)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entitiesToRecycle.push_back({handle, recycle});
+}
+
+void    CommandBuffer::addComponent(const Entity::sHandle& handle, sComponent* component)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _commands.push_back({eCommandType::ADD_COMPONENT, handle, component, component->typeIndex});
+}
+
+void    CommandBuffer::removeComponent(const Entity::sHandle& handle, uint32_t typeIndex)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _commands.push_back({eCommandType::REMOVE_COMPONENT, handle, nullptr, typeIndex});
+}
+
+void    CommandBuffer::flush(EntityManager& em)
+{
+    std::vector<sCommand> commands;
+    std::vector<std::function<void (Entity* entity)> > entitiesToCreate;
+    std::vector<sRecycledEntity> entitiesToRecycle;
+
+    // Take the commands, the flush can record new ones
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        commands.swap(_commands);
+        entitiesToCreate.swap(_entitiesToCreate);
+        entitiesToRecycle.swap(_entitiesToRecycle);
+    }
+
+    for (auto& init: entitiesToCreate)
+    {
+        Entity* entity = em.createEntity();
+        init(entity);
+        em.notifyEntityCreated(entity);
+    }
+
+    // Group the commands by entity, the stable sort keeps the order of the commands of an entity
+    std::stable_sort(commands.begin(), commands.end(), [](const sCommand& lhs, const sCommand& rhs) {
+        return (lhs.handle.value < rhs.handle.value);
+    });
+
+    uint32_t commandsNb = (uint32_t)commands.size();
+    uint32_t begin = 0;
+    while (begin < commandsNb)
+    {
+        uint32_t end = begin + 1;
+        while (end < commandsNb && commands[end].handle == commands[begin].handle)
+        {
+            ++end;
+        }
+
+        flushEntity(em, commands, begin, end);
+        begin = end;
+    }
+
+    // Recycle after the other commands so the entities have their final components
+    for (auto& recycledEntity: entitiesToRecycle)
+    {
+        if (!em.getEntity(recycledEntity.handle))
+        {
+            continue;
+        }
+
+        _recycledComponents.clear();
+        em.destroyEntity(recycledEntity.handle, _recycledComponents);
+        recycledEntity.recycle(_recycledComponents);
+    }
+    _recycledComponents.clear();
+}
+
+void    CommandBuffer::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    deleteComponents(_commands);
+    _commands.clear();
+    _entitiesToCreate.clear();
+    _entitiesToRecycle.clear();
+}
+
+bool    CommandBuffer::empty()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (_commands.empty() && _entitiesToCreate.empty() && _entitiesToRecycle.empty());
+}
+
+void    CommandBuffer::flushEntity(EntityManager& em, const std::vector<sCommand>& commands, uint32_t begin, uint32_t end)
+{
+    Entity* entity = em.getEntity(commands[begin].handle);
+    bool destroy = std::any_of(commands.begin() + begin, commands.begin() + end, [](const sCommand& command) {
+        return (command.type == eCommandType::DESTROY_ENTITY);
+    });
+
+    // The components changes of a destroyed entity are useless
+    if (!entity || destroy)
+    {
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            delete commands[i].component;
+        }
+
+        if (entity)
+        {
+            em.destroyEntity(entity->handle);
+        }
+        return;
+    }
+
+    // Compute the final component of each changed type
+    _changes.clear();
+    _removedComponents.clear();
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const sCommand& command = commands[i];
+        auto change = std::find_if(_changes.begin(), _changes.end(), [&command](const sComponentChange& change_) {
+            return (change_.typeIndex == command.typeIndex);
+        });
+
+        if (change == _changes.end())
+        {
+            _changes.push_back({command.typeIndex, entity->getComponentByType(command.typeIndex), false});
+            change = _changes.end() - 1;
+        }
+
+        // The previous component of the type is replaced or removed
+        if (change->component && change->added)
+        {
+            // Never added to the entity
+            delete change->component;
+        }
+        else if (change->component)
+        {
+            _removedComponents.push_back(change->component);
+        }
+
+        change->component = command.type == eCommandType::ADD_COMPONENT ? command.component : nullptr;
+        change->added = command.type == eCommandType::ADD_COMPONENT;
+    }
+
+    _addedComponents.clear();
+    for (const auto& change: _changes)
+    {
+        if (change.added)
+        {
+            _addedComponents.push_back(change.component);
+        }
+    }
+
+    em.applyComponentsChanges(entity, _removedComponents, _addedComponents);
+}
+
+void    CommandBuffer::deleteComponents(std::vector<sCommand>& commands)
+{
+    for (auto& command: commands)
+    {
+        delete command.component;
+        command.component = nullptr;
+    }
+}
@@ -0,0 +1,27 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <ECS/EntityManager.hpp>
+
+#include <ECS/Component.hh>
+
+void    sComponent::setEnabled(bool enabled)
+{
+    _enabled = enabled;
+
+    // The component can be a copy of another entity component,
+    // only update the disabled mask of the entity owning it
+    if (entity && entity->getComponentByType(typeIndex) == this)
+    {
+        entity->_disabledComponents.set(typeIndex, !enabled);
+    }
+}
+
+void    sComponent::markChanged()
+{
+    if (entity)
+    {
+        _version = entity->_em->getVersion();
+    }
+}
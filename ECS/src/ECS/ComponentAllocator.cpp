@@ -0,0 +1,139 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#include <ECS/ComponentAllocator.hpp>
+
+ComponentAllocator::ComponentAllocator(const char* name, std::size_t size, uint32_t slotsPerChunk):
+    _name(name), _size(size), _slotsPerChunk(slotsPerChunk), _freeSlots(nullptr), _allocatedNb(0),
+    _peakAllocatedNb(0), _allocationsNb(0), _recycledNb(0), _heapAllocationsNb(0)
+{
+    if (_slotsPerChunk == 0)
+    {
+        throw std::invalid_argument("ComponentAllocator: the chunk size can't be 0");
+    }
+
+    // The slots keep the alignment of the chunk and can store the free list link
+    const std::size_t alignment = alignof(std::max_align_t);
+    _slotSize = std::max(_size, sizeof(sFreeSlot));
+    _slotSize = (_slotSize + alignment - 1) / alignment * alignment;
+
+    std::lock_guard<std::mutex> lock(getAllocatorsMutex());
+    getAllocators().push_back(this);
+}
+
+ComponentAllocator::~ComponentAllocator()
+{
+    std::lock_guard<std::mutex> lock(getAllocatorsMutex());
+    auto& allocators = getAllocators();
+    allocators.erase(std::remove(allocators.begin(), allocators.end(), this), allocators.end());
+}
+
+void*   ComponentAllocator::allocate(std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _allocationsNb++;
+    // A derived class which does not redefine operator new
+    if (size != _size)
+    {
+        _heapAllocationsNb++;
+        return (::operator new(size));
+    }
+
+    if (_freeSlots)
+    {
+        _recycledNb++;
+    }
+    else
+    {
+        allocateChunk();
+    }
+
+    sFreeSlot* slot = _freeSlots;
+    _freeSlots = slot->next;
+
+    _allocatedNb++;
+    _peakAllocatedNb = std::max(_peakAllocatedNb, _allocatedNb);
+    return (slot);
+}
+
+void    ComponentAllocator::free(void* ptr, std::size_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    else if (size != _size)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    sFreeSlot* slot = static_cast<sFreeSlot*>(ptr);
+    slot->next = _freeSlots;
+    _freeSlots = slot;
+    _allocatedNb--;
+}
+
+ComponentAllocator::sStats  ComponentAllocator::getStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    sStats stats;
+    stats.name = _name;
+    stats.slotSize = _slotSize;
+    stats.chunksNb = (uint32_t)_chunks.size();
+    stats.allocatedNb = _allocatedNb;
+    stats.peakAllocatedNb = _peakAllocatedNb;
+    stats.allocationsNb = _allocationsNb;
+    stats.recycledNb = _recycledNb;
+    stats.heapAllocationsNb = _heapAllocationsNb;
+    return (stats);
+}
+
+std::vector<ComponentAllocator::sStats> ComponentAllocator::getAllStats()
+{
+    std::lock_guard<std::mutex> lock(getAllocatorsMutex());
+    std::vector<sStats> stats;
+
+    for (ComponentAllocator* allocator: getAllocators())
+    {
+        stats.push_back(allocator->getStats());
+    }
+
+    return (stats);
+}
+
+void    ComponentAllocator::allocateChunk()
+{
+    std::unique_ptr<char[]> chunk(new char[_slotSize * _slotsPerChunk]);
+
+    // Link the slots in address order so the first components are contiguous
+    for (uint32_t i = _slotsPerChunk; i > 0; --i)
+    {
+        sFreeSlot* slot = reinterpret_cast<sFreeSlot*>(chunk.get() + (i - 1) * _slotSize);
+        slot->next = _freeSlots;
+        _freeSlots = slot;
+    }
+
+    _chunks.push_back(std::move(chunk));
+}
+
+std::vector<ComponentAllocator*>&   ComponentAllocator::getAllocators()
+{
+    static std::vector<ComponentAllocator*> allocators;
+    return (allocators);
+}
+
+std::mutex& ComponentAllocator::getAllocatorsMutex()
+{
+    static std::mutex mutex;
+    return (mutex);
+}
@@ -0,0 +1,86 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <ECS/ComponentPool.hpp>
+
+ComponentPool::ComponentPool(uint32_t typeIndex): _typeIndex(typeIndex) {}
+
+ComponentPool::~ComponentPool() {}
+
+void    ComponentPool::add(Entity* entity, sComponent* component)
+{
+    uint32_t index = entity->handle.index;
+
+    if (index >= _sparse.size())
+    {
+        _sparse.resize(index + 1, 0);
+    }
+
+    // An entity can only have one component of each type in the pool
+    if (_sparse[index] != 0)
+    {
+        return;
+    }
+
+    _components.push_back(component);
+    _entities.push_back(entity);
+    _sparse[index] = (uint32_t)_components.size();
+}
+
+bool    ComponentPool::remove(Entity* entity, sComponent* component)
+{
+    uint32_t index = entity->handle.index;
+
+    if (index >= _sparse.size() || _sparse[index] == 0)
+    {
+        return (false);
+    }
+
+    uint32_t denseIdx = _sparse[index] - 1;
+
+    // The component stored for this entity is not the one removed
+    if (_components[denseIdx] != component)
+    {
+        return (false);
+    }
+
+    uint32_t lastIdx = (uint32_t)_components.size() - 1;
+    if (denseIdx != lastIdx)
+    {
+        _components[denseIdx] = _components[lastIdx];
+        _entities[denseIdx] = _entities[lastIdx];
+        _sparse[_entities[denseIdx]->handle.index] = denseIdx + 1;
+    }
+
+    _components.pop_back();
+    _entities.pop_back();
+    _sparse[index] = 0;
+    return (true);
+}
+
+void    ComponentPool::reserve(uint32_t componentsNb)
+{
+    _components.reserve(componentsNb);
+    _entities.reserve(componentsNb);
+}
+
+uint32_t    ComponentPool::getTypeIndex() const
+{
+    return (_typeIndex);
+}
+
+uint32_t    ComponentPool::getSize() const
+{
+    return ((uint32_t)_components.size());
+}
+
+const std::vector<Entity*>& ComponentPool::getEntities() const
+{
+    return (_entities);
+}
+
+const std::vector<sComponent*>& ComponentPool::getComponents() const
+{
+    return (_components);
+}
@@ -0,0 +1,58 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <stdexcept>
+
+#include <ECS/ComponentTypes.hpp>
+
+std::array<std::atomic<uint32_t>, COMPONENT_TYPES_MAX> ComponentTypes::_hashes;
+std::atomic<uint32_t>   ComponentTypes::_typesNb(0);
+
+uint32_t    ComponentTypes::registerType(uint32_t componentHash)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    uint32_t index = findIndex(componentHash);
+
+    if (index != COMPONENT_TYPE_NOT_FOUND)
+    {
+        return (index);
+    }
+
+    uint32_t typesNb = _typesNb.load(std::memory_order_relaxed);
+    if (typesNb >= COMPONENT_TYPES_MAX)
+    {
+        throw std::out_of_range("ComponentTypes::registerType: too many component types, increase COMPONENT_TYPES_MAX");
+    }
+
+    _hashes[typesNb].store(componentHash, std::memory_order_relaxed);
+    _typesNb.store(typesNb + 1, std::memory_order_release);
+    return (typesNb);
+}
+
+uint32_t    ComponentTypes::findIndex(uint32_t componentHash)
+{
+    // The registered hashes are never modified, only the types number has to be synchronized
+    uint32_t typesNb = _typesNb.load(std::memory_order_acquire);
+
+    for (uint32_t i = 0; i < typesNb; ++i)
+    {
+        if (_hashes[i].load(std::memory_order_relaxed) == componentHash)
+        {
+            return (i);
+        }
+    }
+
+    return (COMPONENT_TYPE_NOT_FOUND);
+}
+
+uint32_t    ComponentTypes::getTypesNb()
+{
+    return (_typesNb.load(std::memory_order_acquire));
+}
+
+std::mutex& ComponentTypes::getMutex()
+{
+    static std::mutex mutex;
+    return (mutex);
+}
@@ -58,30 +58,32 @@ void    Entity::addComponent(sComponent* component)
 {
     component->entity = this;
     _components.push_back(component);
+    _signature.set(component->typeIndex);
+    _disabledComponents.set(component->typeIndex, !component->isEnabled());
     _em->notifyEntityNewComponent(this, component);
 }
 
 
-template<typename componentType, typename... Args>
-void Entity::addComponent(Args... args)
+sComponent* Entity::getComponent(size_t componentHashCode) const
 {
-    sComponent* component = new componentType(args...);
-    _components.push_back(component);
-    _em->notifyEntityNewComponent(this, component);
-}
+    uint32_t typeIndex = ComponentTypes::findIndex((uint32_t)componentHashCode);
+
+    if (typeIndex == COMPONENT_TYPE_NOT_FOUND)
+    {
+        return (nullptr);
+    }
 
+    return (getComponentByType(typeIndex));
+}
 
-sComponent* Entity::getComponent(size_t componentHashCode) const
+sComponent* Entity::getComponentByType(uint32_t typeIndex) const
 {
-    for (const auto& component: _components)
+    if (!_signature.test(typeIndex))
     {
-        if (component->id == componentHashCode)
-        {
-            return (component);
-        }
+        return (nullptr);
     }
 
-    return (nullptr);
+    return (_em->_componentPools[typeIndex]->get(this));
 }
 
 std::vector<sComponent*>&   Entity::getComponents()
@@ -100,9 +102,12 @@ void    Entity::removeComponent(sComponent* component)
     {
         if (*it == component)
         {
+            _signature.reset(component->typeIndex);
+            _disabledComponents.reset(component->typeIndex);
             _em->notifyEntityRemovedComponent(this, component);
             delete *it;
             _components.erase(it);
+            _em->dispatchObservers();
             return;
         }
     }
@@ -110,25 +115,76 @@ void    Entity::removeComponent(sComponent* component)
 
 bool    Entity::hasComponent(size_t componentHashCode) const
 {
-    for (const auto& component: _components)
-    {
-        if (component->id == componentHashCode)
-        {
-            return (true);
-        }
-    }
+    uint32_t typeIndex = ComponentTypes::findIndex((uint32_t)componentHashCode);
+
+    return (typeIndex != COMPONENT_TYPE_NOT_FOUND && _signature.test(typeIndex));
+}
+
+const ComponentMask&    Entity::getSignature() const
+{
+    return (_signature);
+}
 
-    return (false);
+const ComponentMask&    Entity::getDisabledComponents() const
+{
+    return (_disabledComponents);
 }
 
 void    Entity::setTag(const std::string& tag)
 {
-    _em->removeEntityFromTagGroup(this, _tag);
-    _tag = tag;
-    _em->addEntityToTagGroup(this, _tag);
+    setTag(EntityTags::getId(tag));
+}
+
+void    Entity::setTag(uint32_t tagId)
+{
+    removeTag(_tagId);
+    _tagId = tagId;
+    addTag(_tagId);
 }
 
 const std::string&  Entity::getTag() const
 {
-    return _tag;
+    return (EntityTags::getName(_tagId));
+}
+
+uint32_t    Entity::getTagId() const
+{
+    return (_tagId);
+}
+
+void    Entity::addTag(uint32_t tagId)
+{
+    if (tagId == ENTITY_TAG_NONE || _tags.test(tagId))
+    {
+        return;
+    }
+
+    _tags.set(tagId);
+    _em->addEntityToTagGroup(this, tagId);
+}
+
+void    Entity::removeTag(uint32_t tagId)
+{
+    if (!_tags.test(tagId))
+    {
+        return;
+    }
+
+    _tags.reset(tagId);
+    _em->removeEntityFromTagGroup(this, tagId);
+}
+
+bool    Entity::hasTag(uint32_t tagId) const
+{
+    return (_tags.test(tagId));
+}
+
+bool    Entity::hasTag(const std::string& tag) const
+{
+    return (hasTag(EntityTags::find(tag)));
+}
+
+const TagMask&  Entity::getTags() const
+{
+    return (_tags);
 }
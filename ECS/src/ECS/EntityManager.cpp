@@ -10,9 +10,19 @@
 #include <ECS/EntityManager.hpp>
 #include <ECS/EntityPool.hpp>
 
-EntityManager::EntityManager(World& world): _world(world)
+std::atomic<uint32_t>   EntityManager::_viewTypesNb(0);
+
+EntityManager::EntityManager(World& world, uint32_t entitiesPerChunk): _world(world), _version(1)
 {
-    _entityPool = std::make_unique<EntityPool>(this, 100);
+    _entityPool = std::make_unique<EntityPool>(this, entitiesPerChunk);
+
+    _componentPools.resize(COMPONENT_TYPES_MAX);
+    for (uint32_t typeIndex = 0; typeIndex < COMPONENT_TYPES_MAX; ++typeIndex)
+    {
+        _componentPools[typeIndex] = std::make_unique<ComponentPool>(typeIndex);
+    }
+
+    _entitiesTagGroups.resize(ENTITY_TAGS_MAX);
 }
 
 EntityManager::~EntityManager() {}
@@ -23,12 +33,27 @@ Entity* EntityManager::createEntity(bool store)
 
     if (store)
     {
-        _entities.push_back(entity);
+        _entities.insert(entity->handle.index, entity);
     }
     return (entity);
 }
 
+void    EntityManager::reserveEntities(uint32_t entitiesNb)
+{
+    _entities.reserve(_entities.size() + entitiesNb);
+}
+
 void    EntityManager::destroyEntity(const Entity::sHandle& entityHandle)
+{
+    destroyEntity(entityHandle, nullptr);
+}
+
+void    EntityManager::destroyEntity(const Entity::sHandle& entityHandle, std::vector<sComponent*>& detachedComponents)
+{
+    destroyEntity(entityHandle, &detachedComponents);
+}
+
+void    EntityManager::destroyEntity(const Entity::sHandle& entityHandle, std::vector<sComponent*>* detachedComponents)
 {
     Entity* entity = getEntity(entityHandle);
     if (!entity)
@@ -36,77 +61,123 @@ void    EntityManager::destroyEntity(const Entity::sHandle& entityHandle)
         return;
     }
 
+    // entityHandle can reference the entity handle which changes when the entity is freed
+    Entity::sHandle handle = entityHandle;
+
     _world.notifyEntityDeleted(entity);
-    std::for_each(entity->_components.begin(), entity->_components.end(), [this, &entity](sComponent* component)
     {
-        removeEntityFromComponentGroup(entity, component->id);
-        delete component;
-    });
+        std::lock_guard<std::mutex> lock(_viewsMutex);
+
+        removeEntityFromViews(entity);
+        std::for_each(entity->_components.begin(), entity->_components.end(), [this, &entity, detachedComponents](sComponent* component)
+        {
+            _componentPools[component->typeIndex]->remove(entity, component);
+            if (detachedComponents)
+            {
+                component->entity = nullptr;
+                detachedComponents->push_back(component);
+            }
+            else
+            {
+                delete component;
+            }
+        });
+    }
     entity->_components.clear();
+    entity->_signature.reset();
+    entity->_disabledComponents.reset();
 
-    removeEntityFromTagGroup(entity, entity->getTag());
+    for (uint32_t tagId = 0; tagId < ENTITY_TAGS_MAX && entity->_tags.any(); ++tagId)
+    {
+        entity->removeTag(tagId);
+    }
+    entity->_tagId = ENTITY_TAG_NONE;
 
-    auto entityIt = std::find(_entities.cbegin(), _entities.cend(), entity);
-    if (entityIt == _entities.cend())
+    if (!_entities.remove(entity->handle.index))
     {
         std::cerr << "Warning: Attempt to delete entity " << entity->handle.index << " which is already deleted" << std::endl;
         return;
     }
-    _entities.erase(entityIt);
     _entityPool->free(entity);
+
+    _observers.onEntityDestroyed(handle);
+    dispatchObservers();
 }
 
 void    EntityManager::destroyEntityRegister(const Entity::sHandle& entityHandle)
 {
-    _entitiesToDestroy.push_back(entityHandle);
+    _commandBuffer.destroyEntity(entityHandle);
 }
 
-void    EntityManager::destroyEntities()
+void    EntityManager::destroyAllEntities()
 {
-    if (_entitiesToDestroy.empty())
-        return;
+    // Don't call the observers, everything is destroyed
+    _observers.clear();
 
-    uint32_t i = 0;
-    uint32_t len = (uint32_t)_entitiesToDestroy.size();
-    for (i; i < len; ++i)
+    // Destroy from the end so the removal from _entities does not move any entity
+    for (std::size_t entitiesNb = _entities.size(); entitiesNb > 0 && !_entities.empty(); --entitiesNb)
     {
-        destroyEntity(_entitiesToDestroy[i]);
+        Entity* entity = _entities[_entities.size() - 1];
+        destroyEntity(entity->handle);
     }
+    _commandBuffer.clear();
+}
 
-    // Other entities have been added to _entitiesToDestroy during destroy
-    if (len != _entitiesToDestroy.size())
-    {
-        _entitiesToDestroy.erase(_entitiesToDestroy.begin(), _entitiesToDestroy.begin() + len);
-    }
-    else
-    {
-        _entitiesToDestroy.clear();
-    }
+CommandBuffer&  EntityManager::getCommandBuffer()
+{
+    return (_commandBuffer);
 }
 
-void    EntityManager::destroyAllEntities()
+void    EntityManager::flushCommands()
+{
+    _flushingCommands = true;
+    _commandBuffer.flush(*this);
+    _flushingCommands = false;
+
+    dispatchObservers();
+}
+
+uint32_t    EntityManager::observeEntityDestroyed(const Entity::sHandle& handle,
+                                                const EntityObservers::Callback& callback,
+                                                const Entity::sHandle& owner)
+{
+    return (_observers.add(handle, ENTITY_OBSERVER_DESTROYED, owner, callback));
+}
+
+uint32_t    EntityManager::observeComponentRemoved(const Entity::sHandle& handle,
+                                                uint32_t typeIndex,
+                                                const EntityObservers::Callback& callback,
+                                                const Entity::sHandle& owner)
+{
+    return (_observers.add(handle, typeIndex, owner, callback));
+}
+
+void    EntityManager::removeObserver(const Entity::sHandle& handle, uint32_t observerId)
+{
+    _observers.remove(handle, observerId);
+}
+
+void    EntityManager::dispatchObservers()
 {
-    for (std::size_t entitiesNb = _entities.size(); entitiesNb > 0; --entitiesNb)
+    if (!_flushingCommands)
     {
-        Entity* entity = _entities[0];
-        destroyEntity(entity->handle);
+        _observers.dispatch(*this);
     }
-    _entitiesToDestroy.clear();
 }
 
-std::vector<Entity*>& EntityManager::getEntities()
+const std::vector<Entity*>& EntityManager::getEntities() const
 {
-    return (_entities);
+    return (_entities.getDense());
 }
 
-const std::vector<Entity*>& EntityManager::getEntitiesByTag(const std::string& tag)
+const std::vector<Entity*>& EntityManager::getEntitiesByTag(uint32_t tagId) const
 {
-    return (_entitiesTagGroups[tag]);
+    return (_entitiesTagGroups[tagId].getDense());
 }
 
-Entity* EntityManager::getEntityByTag(const std::string& tag)
+Entity* EntityManager::getEntityByTag(uint32_t tagId) const
 {
-    const auto& tagGroup = _entitiesTagGroups[tag];
+    const auto& tagGroup = _entitiesTagGroups[tagId];
 
     if (tagGroup.size() > 0)
     {
@@ -116,21 +187,88 @@ Entity* EntityManager::getEntityByTag(const std::string& tag)
     return (nullptr);
 }
 
+const std::vector<Entity*>& EntityManager::getEntitiesByTag(const std::string& tag) const
+{
+    // The entities without tag are not stored in the ENTITY_TAG_NONE group, so an unknown tag gives no entity
+    return (getEntitiesByTag(EntityTags::find(tag)));
+}
+
+Entity* EntityManager::getEntityByTag(const std::string& tag) const
+{
+    return (getEntityByTag(EntityTags::find(tag)));
+}
+
 Entity* EntityManager::getEntity(const Entity::sHandle& handle) const
 {
     return (_entityPool->getEntity(handle));
 }
 
+uint32_t    EntityManager::getVersion() const
+{
+    return (_version);
+}
+
+uint32_t    EntityManager::nextVersion()
+{
+    return (_version++);
+}
+
+ComponentPool*  EntityManager::getComponentPool(uint32_t componentHash) const
+{
+    uint32_t typeIndex = ComponentTypes::findIndex(componentHash);
+
+    if (typeIndex == COMPONENT_TYPE_NOT_FOUND)
+    {
+        return (nullptr);
+    }
+
+    return (getComponentPoolByType(typeIndex));
+}
+
+ComponentPool*  EntityManager::getComponentPoolByType(uint32_t typeIndex) const
+{
+    return (_componentPools[typeIndex].get());
+}
+
 void    EntityManager::notifyEntityNewComponent(Entity* entity, sComponent* component)
 {
-    addEntityToComponentGroup(entity, component->id);
+    component->markChanged();
+
+    // A system updated concurrently can create a view from the component pools
+    {
+        std::lock_guard<std::mutex> lock(_viewsMutex);
+
+        _componentPools[component->typeIndex]->add(entity, component);
+        for (auto& view: _views)
+        {
+            if (view && view->getMask().test(component->typeIndex))
+            {
+                view->onEntityNewComponent(entity);
+            }
+        }
+    }
+
     _world.notifyEntityNewComponent(entity, component);
 }
 
 void    EntityManager::notifyEntityRemovedComponent(Entity* entity, sComponent* component)
 {
-    removeEntityFromComponentGroup(entity, component->id);
+    {
+        std::lock_guard<std::mutex> lock(_viewsMutex);
+
+        _componentPools[component->typeIndex]->remove(entity, component);
+        for (auto& view: _views)
+        {
+            if (view && view->getMask().test(component->typeIndex))
+            {
+                view->onEntityRemoved(entity);
+            }
+        }
+    }
+
     _world.notifyEntityRemovedComponent(entity, component);
+
+    _observers.onComponentRemoved(entity->handle, component->typeIndex);
 }
 
 void    EntityManager::notifyEntityCreated(Entity* entity)
@@ -138,44 +276,85 @@ void    EntityManager::notifyEntityCreated(Entity* entity)
     _world.notifyEntityCreated(entity);
 }
 
-void    EntityManager::addEntityToTagGroup(Entity* entity, const std::string& name)
+void    EntityManager::notifyEntitiesCreated(const std::vector<Entity*>& entities)
 {
-    if (name.size() == 0)
-        return;
+    _world.notifyEntitiesCreated(entities);
+}
 
-    _entitiesTagGroups[name].push_back(entity);
+void    EntityManager::addComponents(Entity* entity, const std::vector<sComponent*>& components)
+{
+    static const std::vector<sComponent*> noRemovedComponents;
+    applyComponentsChanges(entity, noRemovedComponents, components);
 }
 
-void    EntityManager::removeEntityFromTagGroup(Entity* entity, const std::string& name)
+void    EntityManager::addEntityToTagGroup(Entity* entity, uint32_t tagId)
 {
-    if (name.size() == 0)
-        return;
+    _entitiesTagGroups[tagId].insert(entity->handle.index, entity);
+}
 
-    const auto& tagGroup = _entitiesTagGroups.find(name);
-    if (tagGroup == _entitiesTagGroups.end())
-        return;
+void    EntityManager::removeEntityFromTagGroup(Entity* entity, uint32_t tagId)
+{
+    _entitiesTagGroups[tagId].remove(entity->handle.index);
+}
 
-    const auto& entityFind = std::find(tagGroup->second.cbegin(), tagGroup->second.cend(), entity);
-    if (entityFind != tagGroup->second.cend())
+void    EntityManager::removeEntityFromViews(Entity* entity)
+{
+    for (auto& view: _views)
     {
-        tagGroup->second.erase(entityFind);
+        if (view && (view->getMask() & entity->getSignature()).any())
+        {
+            view->onEntityRemoved(entity);
+        }
     }
 }
 
-void    EntityManager::addEntityToComponentGroup(Entity* entity, uint32_t componentHash)
+void    EntityManager::applyComponentsChanges(Entity* entity,
+                                            const std::vector<sComponent*>& removedComponents,
+                                            const std::vector<sComponent*>& addedComponents)
 {
-    _entitiesComponentGroups[componentHash].push_back(entity);
-}
+    ComponentMask changedTypes;
+    std::unique_lock<std::mutex> lock(_viewsMutex);
 
-void    EntityManager::removeEntityFromComponentGroup(Entity* entity, uint32_t componentHash)
-{
-    const auto& componentGroup = _entitiesComponentGroups.find(componentHash);
-    if (componentGroup == _entitiesComponentGroups.end())
-        return;
+    for (sComponent* component: removedComponents)
+    {
+        entity->_components.erase(std::find(entity->_components.begin(), entity->_components.end(), component));
+        entity->_signature.reset(component->typeIndex);
+        entity->_disabledComponents.reset(component->typeIndex);
+        _componentPools[component->typeIndex]->remove(entity, component);
+        changedTypes.set(component->typeIndex);
+    }
+
+    for (sComponent* component: addedComponents)
+    {
+        component->entity = entity;
+        entity->_components.push_back(component);
+        entity->_signature.set(component->typeIndex);
+        entity->_disabledComponents.set(component->typeIndex, !component->isEnabled());
+        component->markChanged();
+        _componentPools[component->typeIndex]->add(entity, component);
+        changedTypes.set(component->typeIndex);
+    }
+
+    // The views store the components, re-insert the entity even if a component is only replaced
+    for (auto& view: _views)
+    {
+        if (view && (view->getMask() & changedTypes).any())
+        {
+            view->onEntityRemoved(entity);
+            view->onEntityNewComponent(entity);
+        }
+    }
+    lock.unlock();
+
+    _world.notifyEntityComponentsChanged(entity, removedComponents, addedComponents);
 
-    const auto& entityFind = std::find(componentGroup->second.cbegin(), componentGroup->second.cend(), entity);
-    if (entityFind != componentGroup->second.cend())
+    for (sComponent* component: removedComponents)
     {
-        componentGroup->second.erase(entityFind);
+        // The component is not replaced
+        if (!entity->_signature.test(component->typeIndex))
+        {
+            _observers.onComponentRemoved(entity->handle, component->typeIndex);
+        }
+        delete component;
     }
 }
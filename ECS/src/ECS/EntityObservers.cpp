@@ -0,0 +1,132 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+
+#include <ECS/EntityManager.hpp>
+
+#include <ECS/EntityObservers.hpp>
+
+EntityObservers::EntityObservers() {}
+
+EntityObservers::~EntityObservers() {}
+
+uint32_t    EntityObservers::add(const Entity::sHandle& handle, uint32_t typeIndex, const Entity::sHandle& owner, const Callback& callback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t observerId = ++_observersIds;
+
+    _observers[handle].push_back({observerId, typeIndex, owner, callback});
+    return (observerId);
+}
+
+void    EntityObservers::remove(const Entity::sHandle& handle, uint32_t observerId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto entityObservers = _observers.find(handle);
+
+    if (entityObservers == _observers.end())
+    {
+        return;
+    }
+
+    auto& observers = entityObservers->second;
+    observers.erase(std::remove_if(observers.begin(), observers.end(), [observerId](const sObserver& observer) {
+        return (observer.id == observerId);
+    }), observers.end());
+
+    if (observers.empty())
+    {
+        _observers.erase(entityObservers);
+    }
+}
+
+void    EntityObservers::onEntityDestroyed(const Entity::sHandle& handle)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_observers.empty())
+    {
+        return;
+    }
+
+    auto entityObservers = _observers.find(handle);
+    if (entityObservers == _observers.end())
+    {
+        return;
+    }
+
+    // The components are removed with the entity, also trigger the components observers
+    for (auto& observer: entityObservers->second)
+    {
+        _triggeredObservers.push_back({handle, observer.owner, std::move(observer.callback)});
+    }
+    _observers.erase(entityObservers);
+}
+
+void    EntityObservers::onComponentRemoved(const Entity::sHandle& handle, uint32_t typeIndex)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_observers.empty())
+    {
+        return;
+    }
+
+    auto entityObservers = _observers.find(handle);
+    if (entityObservers == _observers.end())
+    {
+        return;
+    }
+
+    auto& observers = entityObservers->second;
+    auto triggered = std::stable_partition(observers.begin(), observers.end(), [typeIndex](const sObserver& observer) {
+        return (observer.typeIndex != typeIndex);
+    });
+
+    for (auto observer = triggered; observer != observers.end(); ++observer)
+    {
+        _triggeredObservers.push_back({handle, observer->owner, std::move(observer->callback)});
+    }
+    observers.erase(triggered, observers.end());
+
+    if (observers.empty())
+    {
+        _observers.erase(entityObservers);
+    }
+}
+
+void    EntityObservers::dispatch(const EntityManager& em)
+{
+    std::vector<sTriggeredObserver> triggeredObservers;
+
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_triggeredObservers.empty())
+            {
+                return;
+            }
+            triggeredObservers.swap(_triggeredObservers);
+        }
+
+        for (const auto& observer: triggeredObservers)
+        {
+            // The owner is destroyed, its observers are not valid anymore
+            if (observer.owner.value != 0 && !em.getEntity(observer.owner))
+            {
+                continue;
+            }
+
+            observer.callback(observer.handle);
+        }
+        triggeredObservers.clear();
+    }
+}
+
+void    EntityObservers::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _observers.clear();
+    _triggeredObservers.clear();
+}
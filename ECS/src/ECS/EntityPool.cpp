@@ -2,10 +2,18 @@
 * @Author   Guillaume Labey
 */
 
+#include <stdexcept>
+
 #include <ECS/Entity.hpp>
 #include <ECS/EntityPool.hpp>
 
-EntityPool::EntityPool(EntityManager* em, uint32_t entitiesPerChunk): _em(em), _entitiesPerChunk(entitiesPerChunk) {}
+EntityPool::EntityPool(EntityManager* em, uint32_t entitiesPerChunk): _em(em), _entitiesPerChunk(entitiesPerChunk), _freeHead(0), _freeTail(0)
+{
+    if (_entitiesPerChunk == 0)
+    {
+        throw std::invalid_argument("EntityPool: entities per chunk can't be 0");
+    }
+}
 
 EntityPool::~EntityPool()
 {
@@ -16,75 +24,60 @@ EntityPool::~EntityPool()
 
 Entity* EntityPool::allocate()
 {
-    // Search free entity
+    // No free entity, allocate new chunk
+    if (_freeHead == 0)
     {
-        for (const auto& chunk: _chunks) {
-            if (chunk->freeEntities.size() != 0)
-            {
-                Entity* entity = chunk->entities + chunk->freeEntities.back();
-                entity->_free = false;
-                // Update handle version
-                // All previous handles will be invalidated
-                if (entity->handle.count == ENTITY_HANDLE_MAX_COUNT)
-                {
-                    entity->handle.count = 0;
-                }
-                else
-                {
-                    entity->handle.count++;
-                }
-                chunk->freeEntities.pop_back();
-                return (entity);
-            }
-        }
+        allocateChunk();
     }
 
-    // No free sub-buffer found, allocate new chunk
-    std::unique_ptr<EntityPool::Chunk> chunk = std::make_unique<EntityPool::Chunk>();
-    chunk->idx = (uint32_t)_chunks.size();
+    Entity* entity = getEntityByIndex(_freeHead);
 
-    // Init new entities chunk
+    // Pop the entity from the free list
+    _freeHead = entity->_nextFree;
+    if (_freeHead == 0)
     {
-        chunk->entities = new Entity[_entitiesPerChunk];
-        chunk->freeEntities.resize(_entitiesPerChunk);
-        for (uint32_t i = 0; i < _entitiesPerChunk; ++i) {
-            // We do +1 on id because we want to use 0 id as null entity
-            // So we can do getEntity(0)
-            chunk->entities[i].handle.index = chunk->idx * _entitiesPerChunk + i + 1;
-            chunk->freeEntities[i] = i;
-            chunk->entities[i]._em = _em;
-            chunk->entities[i]._free = true;
-        }
+        _freeTail = 0;
     }
 
-    _chunks.push_back(std::move(chunk));
-
-    return (allocate());
+    entity->_free = false;
+    entity->_nextFree = 0;
+    // Update handle version
+    // All previous handles will be invalidated
+    entity->handle.count = (entity->handle.count + 1) % ENTITY_HANDLE_MAX_COUNT;
+    return (entity);
 }
 
 void EntityPool::free(Entity* entity)
 {
-    // Remember ID is ID + 1
-    uint32_t entityId = entity->handle.index - 1;
+    if (entity->_free)
+    {
+        return;
+    }
 
-    uint32_t chunkNb = entityId / _entitiesPerChunk;
     entity->_free = true;
+    entity->_nextFree = 0;
 
-    auto& chunk = _chunks[chunkNb];
-    chunk->freeEntities.insert(chunk->freeEntities.begin(), entityId % _entitiesPerChunk);
+    // Push the entity at the end of the free list
+    if (_freeTail == 0)
+    {
+        _freeHead = entity->handle.index;
+    }
+    else
+    {
+        getEntityByIndex(_freeTail)->_nextFree = entity->handle.index;
+    }
+    _freeTail = entity->handle.index;
 }
 
 Entity* EntityPool::getEntity(const Entity::sHandle& handle)
 {
     // Remember ID is ID + 1
-    uint32_t chunkNb = (handle.index - 1) / _entitiesPerChunk;
-
-    if (chunkNb >= _chunks.size() || handle.index == 0)
+    if (handle.index == 0 || (handle.index - 1) / _entitiesPerChunk >= _chunks.size())
     {
         return (nullptr);
     }
 
-    Entity* entity = _chunks[chunkNb]->entities + ((handle.index - 1) % _entitiesPerChunk);
+    Entity* entity = getEntityByIndex(handle.index);
 
     if (entity->_free || // The entity is not allocated
         entity->handle != handle) // Outdated handle
@@ -92,3 +85,49 @@ Entity* EntityPool::getEntity(const Entity::sHandle& handle)
 
     return (entity);
 }
+
+uint32_t    EntityPool::getEntitiesPerChunk() const
+{
+    return (_entitiesPerChunk);
+}
+
+uint32_t    EntityPool::getChunksNb() const
+{
+    return ((uint32_t)_chunks.size());
+}
+
+void    EntityPool::allocateChunk()
+{
+    std::unique_ptr<EntityPool::Chunk> chunk = std::make_unique<EntityPool::Chunk>();
+    chunk->idx = (uint32_t)_chunks.size();
+
+    // The handle index has to fit in ENTITY_HANDLE_INDEX_BITS
+    if (((uint64_t)chunk->idx + 1) * _entitiesPerChunk >= POWER_TWO(ENTITY_HANDLE_INDEX_BITS))
+    {
+        throw std::overflow_error("EntityPool: too many entities allocated");
+    }
+
+    // Init new entities chunk
+    chunk->entities = new Entity[_entitiesPerChunk];
+    for (uint32_t i = 0; i < _entitiesPerChunk; ++i) {
+        // We do +1 on id because we want to use 0 id as null entity
+        // So we can do getEntity(0)
+        chunk->entities[i].handle.index = chunk->idx * _entitiesPerChunk + i + 1;
+        chunk->entities[i].handle.count = 0;
+        chunk->entities[i]._em = _em;
+        chunk->entities[i]._free = true;
+        // Link the new entities together, the free list is empty when a chunk is allocated
+        chunk->entities[i]._nextFree = i + 1 < _entitiesPerChunk ? chunk->entities[i].handle.index + 1 : 0;
+    }
+
+    _freeHead = chunk->entities[0].handle.index;
+    _freeTail = chunk->entities[_entitiesPerChunk - 1].handle.index;
+
+    _chunks.push_back(std::move(chunk));
+}
+
+Entity* EntityPool::getEntityByIndex(uint32_t index) const
+{
+    // Remember ID is ID + 1
+    return (_chunks[(index - 1) / _entitiesPerChunk]->entities + ((index - 1) % _entitiesPerChunk));
+}
@@ -0,0 +1,71 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <iostream>
+
+#include <ECS/EntityTags.hpp>
+
+uint32_t    EntityTags::getId(const std::string& tag)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    auto& ids = getIds();
+    auto id = ids.find(tag);
+
+    if (id != ids.end())
+    {
+        return (id->second);
+    }
+
+    auto& names = getNames();
+    if (names.size() >= ENTITY_TAGS_MAX)
+    {
+        std::cerr << "Error: EntityTags::getId: too many tags, \"" << tag << "\" is ignored (increase ENTITY_TAGS_MAX)" << std::endl;
+        return (ENTITY_TAG_NONE);
+    }
+
+    uint32_t newId = (uint32_t)names.size();
+    ids[tag] = newId;
+    names.push_back(tag);
+    return (newId);
+}
+
+uint32_t    EntityTags::find(const std::string& tag)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    auto& ids = getIds();
+    auto id = ids.find(tag);
+
+    return (id != ids.end() ? id->second : ENTITY_TAG_NONE);
+}
+
+const std::string&  EntityTags::getName(uint32_t tagId)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return (getNames().at(tagId));
+}
+
+uint32_t    EntityTags::getTagsNb()
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return ((uint32_t)getNames().size());
+}
+
+std::unordered_map<std::string, uint32_t>&  EntityTags::getIds()
+{
+    // Function static so the tags can be registered during static initialization
+    static std::unordered_map<std::string, uint32_t> ids = {{"", ENTITY_TAG_NONE}};
+    return (ids);
+}
+
+std::deque<std::string>&    EntityTags::getNames()
+{
+    static std::deque<std::string> names = {""};
+    return (names);
+}
+
+std::mutex& EntityTags::getMutex()
+{
+    static std::mutex mutex;
+    return (mutex);
+}
@@ -2,11 +2,10 @@
 * @Author   Guillaume Labey
 */
 
-#include <algorithm>
-
 #include <ECS/System.hpp>
 
-System::System(uint32_t id): _id(id) {}
+System::System(uint32_t id): _exclusive(false), _mainThreadOnly(false), _accessOwnEntitiesOnly(false), _fixedUpdate(false),
+                            _keepEntitiesOrder(false), _id(id) {}
 
 System::~System() {}
 
@@ -30,6 +29,20 @@ void    System::forEachEntity(EntityManager& em, std::function<void(Entity* enti
     }
 }
 
+void    System::parallelForEach(EntityManager& em, const std::function<void (Entity* entity)>& callback, uint32_t grainSize)
+{
+    WorkerPool::getInstance()->parallelFor((uint32_t)_entities.size(), grainSize, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t idx = begin; idx < end; ++idx)
+        {
+            Entity* entity = em.getEntity(_entities[idx]);
+            if (!entity || hasDependencyDisabled(entity))
+                continue;
+
+            callback(entity);
+        }
+    });
+}
+
 uint32_t    System::getId() const
 {
     return (_id);
@@ -40,35 +53,115 @@ uint32_t    System::getEntitiesNb() const
     return ((uint32_t)_entities.size());
 }
 
-bool    System::hasDependencyDisabled(Entity* entity) const
+bool    System::hasEntity(const Entity::sHandle& handle) const
+{
+    return (_entities.contains(handle.index));
+}
+
+const ComponentMask&    System::getDependencies() const
+{
+    return (_dependencies);
+}
+
+const ComponentMask&    System::getReadComponents() const
+{
+    return (_readComponents);
+}
+
+const ComponentMask&    System::getWriteComponents() const
+{
+    return (_writeComponents);
+}
+
+bool    System::isExclusive() const
+{
+    return (_exclusive);
+}
+
+void    System::setExclusive(bool exclusive)
+{
+    _exclusive = exclusive;
+}
+
+bool    System::isMainThreadOnly() const
+{
+    return (_mainThreadOnly);
+}
+
+void    System::setMainThreadOnly(bool mainThreadOnly)
+{
+    _mainThreadOnly = mainThreadOnly;
+}
+
+bool    System::isAccessingOwnEntitiesOnly() const
+{
+    return (_accessOwnEntitiesOnly);
+}
+
+void    System::setAccessOwnEntitiesOnly(bool ownEntitiesOnly)
+{
+    _accessOwnEntitiesOnly = ownEntitiesOnly;
+}
+
+bool    System::isFixedUpdate() const
+{
+    return (_fixedUpdate);
+}
+
+void    System::setFixedUpdate(bool fixedUpdate)
+{
+    _fixedUpdate = fixedUpdate;
+}
+
+bool    System::conflictsWith(const System& system) const
 {
-    for (auto componentHash : _components)
+    if (_exclusive || system._exclusive)
+    {
+        return (true);
+    }
+
+    ComponentMask accessed = _readComponents | _writeComponents;
+    ComponentMask systemAccessed = system._readComponents | system._writeComponents;
+
+    // Read/read accesses never conflict
+    if ((_writeComponents & systemAccessed).none() &&
+        (system._writeComponents & accessed).none())
     {
-        if (!entity->getComponent(componentHash)->enabled)
+        return (false);
+    }
+
+    if (!_accessOwnEntitiesOnly || !system._accessOwnEntitiesOnly)
+    {
+        return (true);
+    }
+
+    // Both systems only access their own entities, they conflict if they share one
+    const System& smallest = getEntitiesNb() < system.getEntitiesNb() ? *this : system;
+    const System& biggest = &smallest == this ? system : *this;
+    for (uint32_t i = 0; i < smallest._entities.size(); ++i)
+    {
+        if (biggest.hasEntity(smallest._entities[i]))
+        {
             return (true);
+        }
     }
 
     return (false);
 }
 
+bool    System::hasDependencyDisabled(Entity* entity) const
+{
+    return ((entity->getDisabledComponents() & _dependencies).any());
+}
+
 bool    System::hasDependency(sComponent* component) const
 {
-    for (auto componentHash : _components)
-    {
-        if (componentHash == component->id)
-            return (true);
-    }
-    return (false);
+    return (_dependencies.test(component->typeIndex));
 }
 
 bool    System::entityMatchDependencies(Entity* entity) const
 {
-    for (auto component: _components)
-    {
-        if (!entity->hasComponent(component))
-            return (false);
-    }
-    return (true);
+    return ((entity->getSignature() & _dependencies) == _dependencies);
 }
 
 bool    System::onEntityNewComponent(Entity* entity, sComponent* component)
@@ -78,9 +171,8 @@ bool    System::onEntityNewComponent(Entity* entity, sComponent* component)
         // The entity has got all components to be in the system
         entityMatchDependencies(entity) &&
         // The entity is not already in the system list
-        std::find(_entities.cbegin(), _entities.cend(), entity->handle) == _entities.cend())
+        _entities.insert(entity->handle.index, entity->handle))
     {
-        _entities.push_back(entity->handle);
         return (true);
     }
     return (false);
@@ -91,25 +183,22 @@ bool    System::onEntityRemovedComponent(Entity* entity, sComponent* component)
     // The system is dependant of the component
     if (hasDependency(component))
     {
-        auto foundEntity = std::find(_entities.cbegin(), _entities.cend(), entity->handle);
-        // The entity is in the system list
-        if (foundEntity != _entities.cend())
-        {
-            _entities.erase(foundEntity);
-            return (true);
-        }
+        return (removeEntity(entity));
     }
     return (false);
 }
 
 bool    System::onEntityDeleted(Entity* entity)
 {
-    auto foundEntity = std::find(_entities.cbegin(), _entities.cend(), entity->handle);
-    // The entity is in the system list
-    if (foundEntity != _entities.cend())
+    return (removeEntity(entity));
+}
+
+bool    System::removeEntity(Entity* entity)
+{
+    if (_keepEntitiesOrder)
     {
-        _entities.erase(foundEntity);
-        return (true);
+        return (_entities.removeOrdered(entity->handle.index));
     }
-    return (false);
+
+    return (_entities.remove(entity->handle.index));
 }
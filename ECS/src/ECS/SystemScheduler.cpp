@@ -0,0 +1,155 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <chrono>
+
+#include <ECS/SystemScheduler.hpp>
+
+SystemScheduler::SystemScheduler(WorkerPool* workerPool): _workerPool(workerPool), _parallel(true) {}
+
+SystemScheduler::~SystemScheduler() {}
+
+void    SystemScheduler::update(std::vector<std::unique_ptr<System> >& systems, EntityManager& em, float elapsedTime,
+                                bool fixedUpdate)
+{
+    _systemsTimes.resize(systems.size(), 0.0f);
+
+    if (_parallel && !_workerPool)
+    {
+        _workerPool = WorkerPool::getInstance();
+    }
+
+    _updatedSystems.clear();
+    for (uint32_t i = 0; i < systems.size(); ++i)
+    {
+        if (systems[i]->isFixedUpdate() == fixedUpdate)
+        {
+            _updatedSystems.push_back(i);
+        }
+    }
+
+    uint32_t updatedSystemsNb = (uint32_t)_updatedSystems.size();
+    uint32_t groupBegin = 0;
+    for (uint32_t i = 0; i <= updatedSystemsNb; ++i)
+    {
+        // Update the group of not exclusive systems before the exclusive system
+        if (i == updatedSystemsNb || !_parallel || systems[_updatedSystems[i]]->isExclusive())
+        {
+            updateGroup(systems, groupBegin, i, em, elapsedTime);
+            groupBegin = i + 1;
+
+            if (i != updatedSystemsNb)
+            {
+                uint32_t systemIdx = _updatedSystems[i];
+                updateSystem(systems[systemIdx].get(), systemIdx, em, elapsedTime);
+            }
+        }
+    }
+}
+
+const std::vector<float>&   SystemScheduler::getSystemsTimes() const
+{
+    return (_systemsTimes);
+}
+
+void    SystemScheduler::setParallel(bool parallel)
+{
+    _parallel = parallel;
+}
+
+bool    SystemScheduler::isParallel() const
+{
+    return (_parallel);
+}
+
+void    SystemScheduler::updateGroup(std::vector<std::unique_ptr<System> >& systems, uint32_t begin, uint32_t end,
+                                    EntityManager& em, float elapsedTime)
+{
+    uint32_t nodesNb = end - begin;
+
+    if (nodesNb == 0)
+    {
+        return;
+    }
+    // Nothing to run concurrently
+    else if (nodesNb == 1)
+    {
+        uint32_t systemIdx = _updatedSystems[begin];
+        updateSystem(systems[systemIdx].get(), systemIdx, em, elapsedTime);
+        return;
+    }
+
+    // Build the dependency graph
+    while (_nodes.size() < nodesNb)
+    {
+        _nodes.push_back(std::make_unique<sNode>());
+    }
+    for (uint32_t i = 0; i < nodesNb; ++i)
+    {
+        sNode& node = *_nodes[i];
+        node.systemIdx = _updatedSystems[begin + i];
+        node.system = systems[node.systemIdx].get();
+        node.successors.clear();
+
+        uint32_t predecessorsNb = 0;
+        for (uint32_t j = 0; j < i; ++j)
+        {
+            if (node.system->conflictsWith(*_nodes[j]->system))
+            {
+                _nodes[j]->successors.push_back(i);
+                predecessorsNb++;
+            }
+        }
+        node.remainingPredecessors = predecessorsNb;
+    }
+
+    // Submit the systems which don't wait for anything, they will submit their successors
+    TaskGroup group;
+    _mainThread = std::this_thread::get_id();
+    for (uint32_t i = 0; i < nodesNb; ++i)
+    {
+        if (_nodes[i]->remainingPredecessors == 0)
+        {
+            submitNode(group, i, em, elapsedTime);
+        }
+    }
+
+    _workerPool->wait(group);
+}
+
+void    SystemScheduler::submitNode(TaskGroup& group, uint32_t nodeIdx, EntityManager& em, float elapsedTime)
+{
+    // The calling thread executes its tasks while waiting for the group
+    std::thread::id thread = _nodes[nodeIdx]->system->isMainThreadOnly() ? _mainThread : std::thread::id();
+
+    _workerPool->submit(group, [this, &group, nodeIdx, &em, elapsedTime]() {
+        runNode(group, nodeIdx, em, elapsedTime);
+    }, thread);
+}
+
+void    SystemScheduler::runNode(TaskGroup& group, uint32_t nodeIdx, EntityManager& em, float elapsedTime)
+{
+    sNode& node = *_nodes[nodeIdx];
+
+    updateSystem(node.system, node.systemIdx, em, elapsedTime);
+
+    for (uint32_t successorIdx: node.successors)
+    {
+        // The last predecessor to finish submits the successor
+        if (--_nodes[successorIdx]->remainingPredecessors == 0)
+        {
+            submitNode(group, successorIdx, em, elapsedTime);
+        }
+    }
+}
+
+void    SystemScheduler::updateSystem(System* system, uint32_t systemIdx, EntityManager& em, float elapsedTime)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    system->update(em, elapsedTime);
+
+    std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+    _systemsTimes[systemIdx] = duration.count();
+}
@@ -0,0 +1,201 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+
+#include <ECS/WorkerPool.hpp>
+
+std::unique_ptr<WorkerPool>  WorkerPool::_instance;
+thread_local uint32_t   WorkerPool::_threadIndex = 0;
+// The index 0 is used by the threads which are not workers
+std::atomic<uint32_t>   WorkerPool::_threadIndicesNb(1);
+
+WorkerPool::WorkerPool(uint32_t workersNb): _stop(false)
+{
+    for (uint32_t i = 0; i < workersNb; ++i)
+    {
+        _workers.emplace_back(&WorkerPool::workerLoop, this, _threadIndicesNb++);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_all();
+
+    for (auto& worker: _workers)
+    {
+        worker.join();
+    }
+}
+
+WorkerPool* WorkerPool::getInstance()
+{
+    if (!_instance)
+    {
+        // hardware_concurrency can return 0 if the value is not computable
+        uint32_t threadsNb = std::thread::hardware_concurrency();
+        _instance = std::make_unique<WorkerPool>(threadsNb > 1 ? threadsNb - 1 : 0);
+    }
+
+    return (_instance.get());
+}
+
+void    WorkerPool::submit(TaskGroup& group, const std::function<void()>& task, std::thread::id thread)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        group._pendingTasksNb++;
+        _tasks.push_back({task, &group, thread});
+    }
+    _condition.notify_all();
+}
+
+void    WorkerPool::wait(TaskGroup& group)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (group._pendingTasksNb != 0)
+    {
+        // Help the workers instead of sleeping
+        auto taskIt = findTask();
+        if (taskIt != _tasks.end())
+        {
+            runTask(lock, taskIt);
+        }
+        else
+        {
+            _condition.wait(lock);
+        }
+    }
+
+    if (group._exception)
+    {
+        std::exception_ptr exception = group._exception;
+        group._exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void    WorkerPool::parallelFor(uint32_t count, uint32_t grainSize, const std::function<void (uint32_t begin, uint32_t end)>& callback)
+{
+    grainSize = std::max(grainSize, 1u);
+
+    // Not enough work to split
+    if (count <= grainSize || _workers.empty())
+    {
+        if (count != 0)
+        {
+            callback(0, count);
+        }
+        return;
+    }
+
+    TaskGroup group;
+    for (uint32_t begin = grainSize; begin < count; begin += grainSize)
+    {
+        uint32_t end = std::min(begin + grainSize, count);
+        submit(group, [&callback, begin, end]() {
+            callback(begin, end);
+        });
+    }
+
+    // The tasks use the callback, wait for them even if the first range throws
+    std::exception_ptr exception;
+    try
+    {
+        callback(0, grainSize);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    wait(group);
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+uint32_t    WorkerPool::getWorkersNb() const
+{
+    return ((uint32_t)_workers.size());
+}
+
+uint32_t    WorkerPool::getThreadIndex()
+{
+    return (_threadIndex);
+}
+
+uint32_t    WorkerPool::getThreadIndicesNb()
+{
+    return (_threadIndicesNb);
+}
+
+void    WorkerPool::workerLoop(uint32_t threadIndex)
+{
+    _threadIndex = threadIndex;
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (!_stop)
+    {
+        auto taskIt = findTask();
+        if (taskIt == _tasks.end())
+        {
+            _condition.wait(lock);
+            continue;
+        }
+
+        runTask(lock, taskIt);
+    }
+}
+
+std::deque<WorkerPool::sTask>::iterator WorkerPool::findTask()
+{
+    std::thread::id threadId = std::this_thread::get_id();
+
+    for (auto taskIt = _tasks.begin(); taskIt != _tasks.end(); ++taskIt)
+    {
+        if (taskIt->thread == std::thread::id() || taskIt->thread == threadId)
+        {
+            return (taskIt);
+        }
+    }
+
+    return (_tasks.end());
+}
+
+void    WorkerPool::runTask(std::unique_lock<std::mutex>& lock, std::deque<sTask>::iterator taskIt)
+{
+    sTask task = std::move(*taskIt);
+    _tasks.erase(taskIt);
+
+    lock.unlock();
+    std::exception_ptr exception;
+    try
+    {
+        task.function();
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+    lock.lock();
+
+    if (exception && !task.group->_exception)
+    {
+        task.group->_exception = exception;
+    }
+
+    task.group->_pendingTasksNb--;
+    if (task.group->_pendingTasksNb == 0)
+    {
+        _condition.notify_all();
+    }
+}
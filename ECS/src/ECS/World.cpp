@@ -4,9 +4,11 @@
 
 #include <ECS/World.hpp>
 
-World::World()
+World::World(uint32_t entitiesPerChunk)
 {
-    _entityManager = std::make_unique<EntityManager>(*this);
+    _entityManager = std::make_unique<EntityManager>(*this, entitiesPerChunk);
+    _systemsByDependency.resize(COMPONENT_TYPES_MAX);
+    _systemsByFirstDependency.resize(COMPONENT_TYPES_MAX);
 }
 
 World::~World() {}
@@ -21,9 +23,37 @@ std::vector<std::unique_ptr<System> >&	World::getSystems()
     return (_systems);
 }
 
+bool    World::hasFixedUpdateSystems() const
+{
+    for (const auto& system_: _systems)
+    {
+        if (system_->isFixedUpdate())
+        {
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+SystemScheduler&    World::getScheduler()
+{
+    return (_scheduler);
+}
+
+void    World::update(float elapsedTime)
+{
+    _scheduler.update(_systems, *_entityManager, elapsedTime);
+}
+
+void    World::fixedUpdate(float fixedTimeStep)
+{
+    _scheduler.update(_systems, *_entityManager, fixedTimeStep, true);
+}
+
 void    World::notifyEntityNewComponent(Entity* entity, sComponent* component)
 {
-    for (auto& system_: _systems)
+    for (System* system_: _systemsByDependency[component->typeIndex])
     {
         system_->onEntityNewComponent(entity, component);
     }
@@ -31,24 +61,95 @@ void    World::notifyEntityNewComponent(Entity* entity, sComponent* component)
 
 void    World::notifyEntityRemovedComponent(Entity* entity, sComponent* component)
 {
-    for (auto& system_: _systems)
+    for (System* system_: _systemsByDependency[component->typeIndex])
     {
         system_->onEntityRemovedComponent(entity, component);
     }
 }
 
-void    World::notifyEntityCreated(Entity* entity)
+void    World::notifyEntityComponentsChanged(Entity* entity,
+                                            const std::vector<sComponent*>& removedComponents,
+                                            const std::vector<sComponent*>& addedComponents)
 {
-    for (auto& system_: _systems)
+    // The entity leaves the systems if it lost or replaced a dependency, then joins them if it matches again
+    for (sComponent* component: removedComponents)
     {
+        notifyEntityRemovedComponent(entity, component);
+    }
+    for (sComponent* component: addedComponents)
+    {
+        notifyEntityNewComponent(entity, component);
+    }
+}
+
+void    World::notifyEntityCreated(Entity* entity)
+{
+    forEachEntitySystem(entity, [entity](System* system_) {
         system_->onEntityCreated(entity);
+    });
+}
+
+void    World::notifyEntitiesCreated(const std::vector<Entity*>& entities)
+{
+    for (Entity* entity: entities)
+    {
+        notifyEntityCreated(entity);
     }
 }
 
 void    World::notifyEntityDeleted(Entity* entity)
 {
-    for (auto& system_: _systems)
-    {
+    forEachEntitySystem(entity, [entity](System* system_) {
         system_->onEntityDeleted(entity);
+    });
+}
+
+void    World::indexSystem(System* system_)
+{
+    const ComponentMask& dependencies = system_->getDependencies();
+
+    // A system without dependency never has entities
+    if (dependencies.none())
+    {
+        return;
+    }
+
+    bool firstDependency = true;
+    for (uint32_t typeIndex = 0; typeIndex < COMPONENT_TYPES_MAX; ++typeIndex)
+    {
+        if (!dependencies.test(typeIndex))
+        {
+            continue;
+        }
+
+        _systemsByDependency[typeIndex].push_back(system_);
+        if (firstDependency)
+        {
+            _systemsByFirstDependency[typeIndex].push_back(system_);
+            _firstDependencies.set(typeIndex);
+            firstDependency = false;
+        }
+    }
+}
+
+void    World::forEachEntitySystem(Entity* entity, const std::function<void (System* system_)>& callback)
+{
+    ComponentMask types = entity->getSignature() & _firstDependencies;
+
+    for (uint32_t typeIndex = 0; types.any(); ++typeIndex)
+    {
+        if (!types.test(typeIndex))
+        {
+            continue;
+        }
+
+        types.reset(typeIndex);
+        for (System* system_: _systemsByFirstDependency[typeIndex])
+        {
+            if (system_->hasEntity(entity->handle))
+            {
+                callback(system_);
+            }
+        }
     }
 }
@@ -9,6 +9,7 @@
 
 #include <ECS/Entity.hpp>
 #include <Engine/Debug/Logger.hpp>
+#include <Engine/EntityFactory.hpp>
 #include <Engine/Utils/JsonValue.hpp>
 #include <Engine/Window/GameWindow.hpp>
 
@@ -54,6 +55,8 @@ protected:
     }
 
     virtual Entity* Instantiate(std::string, glm::vec3 pos = glm::vec3(0,0,0));
+    // Cache the blueprint with EntityFactory::getBlueprint to instantiate the type without strings lookups
+    virtual Entity* Instantiate(const EntityFactory::sBlueprintHandle& blueprint, glm::vec3 pos = glm::vec3(0,0,0));
 
     virtual const std::vector<Entity*>& GetEntitiesByTag(const std::string& tag);
     virtual void Destroy();
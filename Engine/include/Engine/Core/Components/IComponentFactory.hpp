@@ -33,6 +33,8 @@
 
 #define GENERATE_PAIRS_HASHS(COMPONENT) { COMPONENT::identifier, #COMPONENT }
 
+#define GENERATE_TYPES_INDICES(COMPONENT) ComponentTypes::getIndex<COMPONENT>()
+
 class IComponentFactory
 {
 public:
@@ -56,10 +58,14 @@ public:
     static std::string                                              getComponentNameWithHash(uint32_t hash);
     static std::size_t                                              getComponentHashWithName(const std::string& name);
     static const std::unordered_map<uint32_t, std::string>&         getComponentsTypesHashs();
+    // Incremented each time a template component is added, replaced or removed (See EntityFactory::getBlueprint)
+    static uint32_t                                                 getTemplatesVersion();
 
     // ComponentFactory overloaded classes methods
     // Ex: ComponentFactory<sInputComponent>
     virtual sComponent*                                             clone(const std::string& entityType) = 0;
+    // Template component of the entity type
+    virtual sComponent*                                             getComponent(const std::string& entityType) = 0;
     virtual void                                                    addComponent(const std::string& entityType, sComponent* component) = 0;
     virtual void                                                    saveComponentJson(const std::string& entityType, const JsonValue& json) = 0;
     virtual bool                                                    updateEditor(const std::string& entityType, sComponent** savedComponent, sComponent* entityComponent, Entity* entity) = 0;
@@ -70,6 +76,8 @@ protected:
 
     // Map lookup to get component name with component hash
     static std::unordered_map<uint32_t, std::string>             _componentsTypesHashs;
+
+    static uint32_t                                                 _templatesVersion;
 };
 
 
@@ -99,17 +107,20 @@ public:
     {
         delete _components[entityType];
         _components[entityType] = component->clone();
+        ++_templatesVersion;
     }
 
     void remove(const std::string& entityType)  override final
     {
         _components.erase(entityType);
+        ++_templatesVersion;
     }
 
     // Add entity in component entities map
     void addComponent(const std::string& entityType, sComponent* component)  override final
     {
         _components[entityType] = component;
+        ++_templatesVersion;
     }
 
     // Save component json in case saveToJson is not overloaded and
@@ -133,6 +144,11 @@ private:
         return _components.at(entityType)->clone();
     }
 
+    sComponent*         getComponent(const std::string& entityType)
+    {
+        return _components.at(entityType);
+    }
+
 protected:
     // One component per entity type
     std::unordered_map<std::string, sComponent*>    _components;
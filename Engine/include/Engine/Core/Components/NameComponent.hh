@@ -9,7 +9,7 @@
 #include <ECS/Component.hh>
 
 START_COMPONENT(sNameComponent)
-sNameComponent(const std::string& name) : value(name), sComponent(sNameComponent::identifier) {}
+sNameComponent(const std::string& name) : value(name), sComponent(sNameComponent::identifier, ComponentTypes::getIndex<sNameComponent>()) {}
 
 virtual sComponent* clone()
 {
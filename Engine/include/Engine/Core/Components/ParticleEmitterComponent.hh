@@ -24,6 +24,31 @@ virtual sComponent* clone()
 }
 
 virtual void update(sParticleEmitterComponent* component)
+{
+    updateProperties(component);
+
+    if (component->_modelInstance)
+    {
+        this->_modelInstance = std::make_unique<ModelInstance>(*component->_modelInstance);
+    }
+}
+
+// Keep the model instance if the recycled component has the same model
+virtual void reset(sComponent* prototype)
+{
+    sParticleEmitterComponent* component = static_cast<sParticleEmitterComponent*>(prototype);
+    bool sameModel = _modelInstance && this->modelFile == component->modelFile && this->type == component->type;
+
+    updateProperties(component);
+    setEnabled(component->isEnabled());
+
+    if (!sameModel)
+    {
+        this->_modelInstance = component->_modelInstance ? std::make_unique<ModelInstance>(*component->_modelInstance) : nullptr;
+    }
+}
+
+void updateProperties(sParticleEmitterComponent* component)
 {
     this->rate = component->rate;
     this->maxParticles = component->maxParticles;
@@ -47,10 +72,6 @@ virtual void update(sParticleEmitterComponent* component)
 
     this->modelFile = component->modelFile;
     this->type = component->type;
-    if (component->_modelInstance)
-    {
-        this->_modelInstance = std::make_unique<ModelInstance>(*component->_modelInstance);
-    }
 }
 
 virtual void update(sComponent* component)
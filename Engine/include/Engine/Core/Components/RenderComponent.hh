@@ -25,15 +25,39 @@ virtual sComponent* clone()
 
 virtual void update(sRenderComponent* component)
 {
-    this->modelFile = component->modelFile;
-    this->color = component->color;
-    this->animated = component->animated;
+    updateProperties(component);
 
     if (component->_modelInstance)
     {
         this->_modelInstance = std::make_unique<ModelInstance>(*component->_modelInstance);
     }
+}
 
+virtual void update(sComponent* component)
+{
+    update(static_cast<sRenderComponent*>(component));
+}
+
+// Keep the model instance and its buffer if the recycled component has the same model
+virtual void reset(sComponent* prototype)
+{
+    sRenderComponent* component = static_cast<sRenderComponent*>(prototype);
+    bool sameModel = _modelInstance && this->modelFile == component->modelFile && this->type == component->type;
+
+    updateProperties(component);
+    setEnabled(component->isEnabled());
+
+    if (!sameModel)
+    {
+        this->_modelInstance = component->_modelInstance ? std::make_unique<ModelInstance>(*component->_modelInstance) : nullptr;
+    }
+}
+
+void updateProperties(sRenderComponent* component)
+{
+    this->modelFile = component->modelFile;
+    this->color = component->color;
+    this->animated = component->animated;
     this->type = component->type;
     this->_animator = component->_animator;
     this->display = component->display;
@@ -42,11 +66,6 @@ virtual void update(sRenderComponent* component)
     this->hideDynamic = component->hideDynamic;
 }
 
-virtual void update(sComponent* component)
-{
-    update(static_cast<sRenderComponent*>(component));
-}
-
 void initModelInstance()
 {
     if (type == Geometry::eType::MESH)
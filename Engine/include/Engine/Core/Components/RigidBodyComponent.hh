@@ -10,6 +10,7 @@
 
 #include <ECS/Component.hh>
 #include <ECS/Entity.hpp>
+#include <ECS/EntityTags.hpp>
 
 enum class eCollisionState : uint8_t
 {
@@ -34,6 +35,7 @@ virtual void update(sRigidBodyComponent* component)
     this->velocity = component->velocity;
     this->collisionsEnabled = component->collisionsEnabled;
     this->ignoredTags = component->ignoredTags;
+    this->ignoredTagsMask = component->ignoredTagsMask;
 }
 
 virtual void update(sComponent* component)
@@ -41,11 +43,36 @@ virtual void update(sComponent* component)
     update(static_cast<sRigidBodyComponent*>(component));
 }
 
+void updateIgnoredTagsMask()
+{
+    ignoredTagsMask.reset();
+    for (const auto& ignoredTag: ignoredTags)
+    {
+        ignoredTagsMask.set(EntityTags::getId(ignoredTag));
+    }
+}
+
+virtual void reset(sComponent* prototype)
+{
+    update(prototype);
+    setEnabled(prototype->isEnabled());
+    collisions.clear();
+    interpolated = false;
+}
+
 glm::vec3 gravity;
 glm::vec3 velocity;
+// The collisions with an entity are removed when the entity is destroyed (See CollisionSystem)
 std::unordered_map<Entity::sHandle, eCollisionState> collisions;
 std::vector<std::string> ignoredTags;
+// Resolved ignoredTags, has to be updated when ignoredTags is modified
+TagMask ignoredTagsMask;
 bool collisionsEnabled;
 
+// Positions before and after the last fixed update, interpolated by the RenderingSystem
+glm::vec3 previousPos;
+glm::vec3 simulatedPos;
+bool interpolated = false;
+
 int selectedTags = -1;
 END_COMPONENT(sRigidBodyComponent)
@@ -41,6 +41,15 @@ virtual void            update(sComponent* component)
     update(static_cast<sScriptComponent*>(component));
 }
 
+// The scripts are created again so they are started with their default state
+virtual void            reset(sComponent* prototype)
+{
+    scripts.clear();
+    selectedScript = nullptr;
+    update(prototype);
+    setEnabled(prototype->isEnabled());
+}
+
 bool                    hasScript(const char* name)
 {
     for (const auto& script: scripts)
@@ -32,6 +32,7 @@ virtual void update(sTransformComponent* component)
     this->_right = component->_right;
     this->_posOffsetLocal = component->_posOffsetLocal;
     this->_posOffsetWorld = component->_posOffsetWorld;
+    needUpdate();
 }
 
 virtual void update(sComponent* component)
@@ -39,6 +40,12 @@ virtual void update(sComponent* component)
     update(static_cast<sTransformComponent*>(component));
 }
 
+// Stamp the component version, the rendering only uploads the transforms changed since the previous frame
+virtual void onTransformChanged()
+{
+    markChanged();
+}
+
 // Used only for ImgGuizmo display
 glm::vec3 _posOffsetLocal;
 glm::vec3 _posOffsetWorld;
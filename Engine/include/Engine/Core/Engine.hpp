@@ -6,12 +6,15 @@
 
 #include <memory>
 
+#include <Engine/Core/FramePacer.hpp>
 #include <Engine/Core/GameStateManager.hpp>
 #include <Engine/Graphics/Renderer.hpp>
+#include <Engine/Utils/Timer.hpp>
 #include <Engine/Sound/SoundManager.hpp>
 #include <Engine/Debug/DebugWindow.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Window/GameWindow.hpp>
+#include <Engine/Window/InputRecorder.hpp>
 
 class Engine
 {
@@ -23,6 +26,8 @@ public:
     bool                                    run(int ac, char** av, std::shared_ptr<GameState> startGameState);
     bool                                    stop();
     GameStateManager&                       getGameStateManager();
+    FramePacer&                             getFramePacer();
+    InputRecorder&                          getInputRecorder();
 
     template<typename T, typename... Args>
     void                                    addDebugWindow(Args... args)
@@ -68,12 +73,24 @@ private:
     bool                                    initDebugWindows(int ac, char** av);
     bool                                    initStartGameState(std::shared_ptr<GameState> startGameState);
 
+    // Count the headless ticks and report the ticks rate, return false when the ticks limit is reached
+    bool                                    updateHeadlessTicks();
+    void                                    reportHeadlessTicks() const;
+
 private:
     GameStateManager                        _gameStateManager;
     std::shared_ptr<GameWindow>             _window;
     std::shared_ptr<SoundManager>           _soundManager;
     std::shared_ptr<Renderer>               _renderer;
     std::shared_ptr<Logger>                 _logger;
+    FramePacer                              _framePacer;
+    InputRecorder                           _inputRecorder;
+
+    // Headless ticks rate
+    uint32_t                                _ticksNb{0};
+    uint32_t                                _secondTicksNb{0};
+    Timer                                   _ticksTimer;
+    Timer                                   _secondTicksTimer;
 
     std::vector<std::shared_ptr<DebugWindow>> _debugWindows;
 };
@@ -0,0 +1,89 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#define FRAME_PACER_DEFAULT_FPS             60.0f
+#define FRAME_PACER_DEFAULT_UNFOCUSED_FPS   30.0f
+#define FRAME_PACER_DEFAULT_MINIMIZED_FPS   5.0f
+
+/*
+** Wait between the frames until the deadline of the next frame, without burning a core.
+** The pacer sleeps while the remaining time is above the estimated duration of a sleep
+** (measured, so it works with the coarse schedulers) and spins the rest of the time.
+** The frame rate is throttled when the window is unfocused or minimized.
+*/
+class FramePacer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Stats of the last complete second
+    struct sStats
+    {
+        float           targetFps;
+        uint32_t        framesNb;
+        float           avgFrameTime;
+        // Difference between the deadlines and the frames start
+        float           avgJitter;
+        float           maxJitter;
+        // Part of the time spent sleeping
+        float           sleepPercent;
+        // Frames started more than a frame late, their deadline is reset
+        uint32_t        missedDeadlinesNb;
+    };
+
+public:
+    FramePacer();
+    ~FramePacer();
+
+    // 0 for unlimited frame rates
+    void                setTargetFps(float fps);
+    void                setUnfocusedFps(float fps);
+    void                setMinimizedFps(float fps);
+
+    float               getTargetFps() const;
+    float               getUnfocusedFps() const;
+    float               getMinimizedFps() const;
+
+    // Wait the start of the next frame
+    void                waitNextFrame(bool focused, bool minimized);
+
+    const sStats&       getStats() const;
+
+private:
+    // Sleep for the coarse part of the wait and spin for the rest
+    void                sleepUntil(const Clock::time_point& deadline);
+    void                updateSleepEstimate(double sleepTime);
+    void                updateStats(const Clock::time_point& frameStart, double jitter, double frameTime);
+
+private:
+    float               _targetFps;
+    float               _unfocusedFps;
+    float               _minimizedFps;
+
+    Clock::time_point   _nextDeadline;
+    Clock::time_point   _lastFrameStart;
+    bool                _started{false};
+
+    // Estimated duration of a 1 ms sleep (mean + standard deviation of the measured sleeps)
+    double              _sleepEstimate;
+    double              _sleepMean;
+    double              _sleepM2;
+    uint32_t            _sleepsNb;
+
+    // Stats of the current second
+    Clock::time_point   _statsStart;
+    uint32_t            _framesNb{0};
+    double              _frameTimeSum{0};
+    double              _jitterSum{0};
+    double              _jitterMax{0};
+    double              _sleepTimeSum{0};
+    uint32_t            _missedDeadlinesNb{0};
+
+    sStats              _stats;
+};
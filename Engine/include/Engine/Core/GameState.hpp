@@ -10,6 +10,10 @@
 #include <ECS/World.hpp>
 #include <ECS/EntityManager.hpp>
 
+#define GAME_STATE_DEFAULT_FIXED_TIME_STEP          (1.0f / 60.0f)
+// Above this number of steps in a frame, the simulation slows down instead of catching up
+#define GAME_STATE_DEFAULT_MAX_FIXED_STEPS          5
+
 class GameWindow;
 class GameStateManager;
 
@@ -33,10 +37,14 @@ public:
 
     uint32_t                getId() const;
     float                   getTimeSpeed() const;
+    float                   getFixedTimeStep() const;
+    uint32_t                getMaxFixedStepsPerFrame() const;
     World&                  getWorld();
 
     void                    setLevelFile(const std::string& levelFile);
     void                    setTimeSpeed(float timeSpeed);
+    void                    setFixedTimeStep(float fixedTimeStep);
+    void                    setMaxFixedStepsPerFrame(uint32_t maxFixedSteps);
 
     void                    cloneEntityManager(EntityManager* em);
 
@@ -46,6 +54,11 @@ protected:
 private:
     void                    loadLevel();
     void                    onWindowResize();
+    // Run the fixed update systems for the elapsed time and return the interpolation factor
+    // between the last two simulated states
+    float                   fixedUpdate(float elapsedTime);
+    // Save the rigid bodies positions at the end of a fixed step, interpolated by the RenderingSystem
+    void                    saveSimulatedPositions();
 
 protected:
     World                   _world;
@@ -56,6 +69,11 @@ protected:
     uint32_t                _id;
 
     float                   _timeSpeed = 1.0f;
+
+    float                   _fixedTimeStep = GAME_STATE_DEFAULT_FIXED_TIME_STEP;
+    uint32_t                _maxFixedStepsPerFrame = GAME_STATE_DEFAULT_MAX_FIXED_STEPS;
+    // Elapsed time not simulated yet
+    float                   _fixedTimeAccumulator = 0.0f;
 };
 
 
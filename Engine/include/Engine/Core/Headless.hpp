@@ -0,0 +1,41 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+
+// Size of the window reported in headless mode, used by the UI layout and the cameras viewports
+#define HEADLESS_WINDOW_WIDTH   1920
+#define HEADLESS_WINDOW_HEIGHT  1080
+
+#define HEADLESS_DEFAULT_TICK_TIME  (1.0f / 60.0f)
+
+/*
+** Run the game states, the systems and the scripts without window, opengl context and sound device
+** (build servers, simulation throughput measurements...).
+** The GameWindow has no GLFW window and no input, the Renderer and the graphics resources don't make any opengl call
+** and the SoundManager doesn't load or play the sounds.
+** Each tick advances the simulation of a fixed time, so the ticks can run faster than real time.
+** Has to be chosen before Engine::init
+*/
+class Headless
+{
+public:
+    static bool         isEnabled();
+    static void         setEnabled(bool enabled);
+
+    // Number of frames run before the engine stops, 0 to run until the window is closed
+    static uint32_t     getTicksLimit();
+    static void         setTicksLimit(uint32_t ticksLimit);
+
+    // Elapsed time given to the game states at each tick
+    static float        getTickTime();
+    static void         setTickTime(float tickTime);
+
+private:
+    static bool         _enabled;
+    static uint32_t     _ticksLimit;
+    static float        _tickTime;
+};
@@ -0,0 +1,120 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+// Maximum number of allocation tags, the tags registered after are counted as untagged
+#define ALLOCATION_TRACKER_MAX_TAGS             128
+#define ALLOCATION_TRACKER_UNTAGGED             0
+#define ALLOCATION_TRACKER_DEFAULT_DUMP_FILE    "allocations.txt"
+
+#define ALLOCATION_CONCAT_(lhs, rhs)    lhs##rhs
+#define ALLOCATION_CONCAT(lhs, rhs)     ALLOCATION_CONCAT_(lhs, rhs)
+
+// Configure cmake with -DENGINE_ALLOCATION_TRACKER=ON to replace the global operator new/delete
+#if defined(ENGINE_ALLOCATION_TRACKER)
+    // The tag is registered once for each call site, the name has to live until the end of the program
+    #define ALLOCATION_SCOPE(name)  static const uint16_t ALLOCATION_CONCAT(allocationTag, __LINE__) = AllocationTracker::registerTag(name); \
+                                    AllocationScope ALLOCATION_CONCAT(allocationScope, __LINE__)(ALLOCATION_CONCAT(allocationTag, __LINE__))
+#else
+    #define ALLOCATION_SCOPE(name)
+#endif
+
+/*
+** Count the heap allocations made in the allocation scopes (systems, engine stages, resources loading...).
+** Each allocation is attributed to the innermost scope of its thread, the allocations of the other threads
+** (workers of a parallel system) are attributed to their own scopes or are untagged.
+** The freed bytes are attributed to the tag of the allocation, which gives the memory footprint of each tag.
+*/
+class AllocationTracker
+{
+public:
+    struct sTagStats
+    {
+        const char*             name;
+
+        // Updated at the end of each frame
+        uint64_t                frameAllocationsNb;
+        uint64_t                frameBytes;
+        uint64_t                peakFrameAllocationsNb;
+        uint64_t                peakFrameBytes;
+
+        int64_t                 liveBytes;
+        // High-water mark of the live bytes
+        int64_t                 peakLiveBytes;
+    };
+
+private:
+    struct sTag
+    {
+        const char*             name;
+
+        std::atomic<uint64_t>   allocationsNb;
+        std::atomic<uint64_t>   bytes;
+        std::atomic<int64_t>    liveBytes;
+        std::atomic<int64_t>    peakLiveBytes;
+
+        sTagStats               stats;
+    };
+
+public:
+    // Return false if the tracker is not compiled
+    static bool                 isEnabled();
+
+    static uint16_t             registerTag(const char* name);
+    static uint16_t             getCurrentTag();
+    // Return the previous tag
+    static uint16_t             setCurrentTag(uint16_t tag);
+
+    static void                 onAllocation(uint16_t tag, uint64_t size);
+    static void                 onFree(uint16_t tag, uint64_t size);
+
+    // Save the allocations of the frame and reset the counters
+    static void                 endFrame();
+
+    static void                 forEachTag(const std::function<void (const sTagStats& stats)>& callback);
+    static int64_t              getLiveBytes();
+    static int64_t              getPeakLiveBytes();
+
+    static void                 dump(std::ostream& stream);
+    static bool                 dump(const std::string& fileName);
+
+private:
+    static void                 updatePeak(std::atomic<int64_t>& peak, int64_t value);
+
+private:
+    // Zero-initialized before any dynamic initialization, the static objects can allocate in their constructors
+    static std::array<sTag, ALLOCATION_TRACKER_MAX_TAGS> _tags;
+    static std::atomic<uint16_t>    _tagsNb;
+    static std::mutex           _tagsMutex;
+    static thread_local uint16_t    _currentTag;
+
+    static std::atomic<int64_t> _liveBytes;
+    static std::atomic<int64_t> _peakLiveBytes;
+};
+
+/*
+** Attribute the allocations of the thread to the tag for the lifetime of the scope
+*/
+class AllocationScope
+{
+public:
+    AllocationScope(uint16_t tag): _previousTag(AllocationTracker::setCurrentTag(tag)) {}
+
+    ~AllocationScope()
+    {
+        AllocationTracker::setCurrentTag(_previousTag);
+    }
+
+private:
+    uint16_t                    _previousTag;
+};
@@ -70,6 +70,10 @@ public:
     void                            setLogLevel(Logger::eLogLevel logLevel);
     Logger::eLogLevel               getLogLevel() const;
 
+    // Also write the logs on the standard output (headless mode, the build servers read it)
+    void                            setStdoutEnabled(bool stdoutEnabled);
+    bool                            isStdoutEnabled() const;
+
 private:
     std::string                     getDateToString();
     void                            addConsoleLog(const sLogInfo& logInfo);
@@ -83,6 +87,8 @@ private:
     sConsoleLog                 _log;
 
     Logger::eLogLevel           _logLevel;
+
+    bool                        _stdoutEnabled;
 };
 
 REGISTER_ENUM_MANAGER(Logger::eLogLevel, LOG_LEVELS)
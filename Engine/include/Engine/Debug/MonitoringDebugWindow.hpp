@@ -8,6 +8,7 @@
 #include <vector>
 #include <map>
 
+#include <Engine/Core/FramePacer.hpp>
 #include <Engine/Debug/Debug.hpp>
 #include <Engine/Utils/Helper.hpp>
 #include <Engine/Utils/Timer.hpp>
@@ -41,6 +42,7 @@ public:
     void                                            build(std::shared_ptr<GameState> gameState, float elapsedTime) override final;
 
     void                                            updateSystem(uint16_t key, float timeSec, uint32_t nbEntities, const char* name);
+    void                                            updateFramePacing(const FramePacer::sStats& stats);
 
     GENERATE_ID(MonitoringDebugWindow);
 
@@ -49,11 +51,18 @@ private:
     void                                            updateTimeLogsSystem(tMonitoring& system, bool *resetCheckSec);
     ImColor                                         getDisplayColor(tMonitoring& system);
     void                                            displaySystem(tMonitoring& system);
+    // Stats of the components allocators
+    void                                            displayComponentsMemory();
+    void                                            displayEntityPools();
+    void                                            displayFramePacing();
+    void                                            displayGpuPasses();
+    void                                            displayAllocations();
 
 private:
     static std::shared_ptr<MonitoringDebugWindow>   _monitoringDebugWindow;
 
     std::map<uint16_t, tMonitoring>                 _systemsRegistered;
     float                                           _checkSec;
+    FramePacer::sStats                              _framePacing{};
 };
 
@@ -0,0 +1,142 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Configure cmake with -DENGINE_NO_PROFILER=ON to remove the profiler zones at compile time
+#if !defined(ENGINE_NO_PROFILER)
+    #define ENGINE_PROFILER
+#endif
+
+// Events kept by each thread, the oldest are overwritten
+#define PROFILER_EVENTS_PER_THREAD  (1 << 16)
+#define PROFILER_DEFAULT_TRACE_FILE "profile.json"
+// Frames recorded by a capture started during the game (F12)
+#define PROFILER_DEFAULT_CAPTURE_FRAMES 300
+
+#define PROFILER_CONCAT_(lhs, rhs)  lhs##rhs
+#define PROFILER_CONCAT(lhs, rhs)   PROFILER_CONCAT_(lhs, rhs)
+
+#if defined(ENGINE_PROFILER)
+    // The name has to be a string literal (or live until the trace is dumped)
+    #define PROFILE_ZONE(name)          ProfilerZone PROFILER_CONCAT(profilerZone, __LINE__)(name)
+    #define PROFILE_FUNCTION()          PROFILE_ZONE(__FUNCTION__)
+    // The std::string name is copied once, for the names not known at compile time (scripts...)
+    #define PROFILE_ZONE_DYNAMIC(name)  ProfilerZone PROFILER_CONCAT(profilerZone, __LINE__)(static_cast<const std::string&>(name))
+    #define PROFILE_END_FRAME()         Profiler::endFrame()
+#else
+    #define PROFILE_ZONE(name)
+    #define PROFILE_FUNCTION()
+    #define PROFILE_ZONE_DYNAMIC(name)
+    #define PROFILE_END_FRAME()
+#endif
+
+/*
+** Record the zones (begin and end time of a scope) of each thread in a ring buffer
+** and dump them in the Chrome trace event JSON format (chrome://tracing, Perfetto...).
+** Each thread writes in its own buffer, the dump has to be done when the workers are idle (between the frames).
+** The zones are only recorded during a capture (See captureFrames), the disabled zones only read a flag.
+*/
+class Profiler
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct sEvent
+    {
+        const char*         name;
+        // Nanoseconds since the profiler start
+        uint64_t            start;
+        uint64_t            duration;
+    };
+
+    struct sThreadBuffer
+    {
+        std::string         name;
+        uint32_t            id;
+        std::vector<sEvent> events;
+        // Total number of events written, the next event is written at eventsNb % events.size()
+        uint64_t            eventsNb;
+    };
+
+public:
+    static bool             isEnabled();
+    static void             setEnabled(bool enabled);
+
+    static uint64_t         getTime();
+    static void             addEvent(const char* name, uint64_t start, uint64_t end);
+    static const char*      internName(const std::string& name);
+    // Add an event to a timeline which is not a CPU thread (GPU...), the timestamps are in the profiler time
+    static void             addTrackEvent(const std::string& trackName, const char* name, uint64_t start, uint64_t end);
+
+    // Record the next framesNb frames, then dump the trace and stop recording
+    // The events of the previous captures are discarded, 0 cancels the capture
+    static void             captureFrames(uint32_t framesNb, const std::string& fileName = PROFILER_DEFAULT_TRACE_FILE);
+    static void             endFrame();
+
+    static bool             dumpChromeTrace(const std::string& fileName);
+
+private:
+    static sThreadBuffer*   getThreadBuffer();
+    // The mutex has to be locked
+    static sThreadBuffer*   createBuffer(const std::string& name);
+    static void             addEvent(sThreadBuffer* buffer, const char* name, uint64_t start, uint64_t end);
+    static void             writeEscapedString(std::ostream& stream, const char* str);
+
+private:
+    static std::atomic<bool>    _enabled;
+    static Clock::time_point    _startTime;
+
+    static std::mutex           _mutex;
+    static std::vector<std::unique_ptr<sThreadBuffer> > _threadsBuffers;
+    static thread_local sThreadBuffer*  _threadBuffer;
+    static std::unordered_map<std::string, sThreadBuffer*> _tracksBuffers;
+    static std::unordered_set<std::string>  _names;
+
+    static uint32_t             _framesNb;
+    static uint32_t             _captureFramesNb;
+    static std::string          _captureFileName;
+};
+
+/*
+** Add a profiler event for the lifetime of the zone
+*/
+class ProfilerZone
+{
+public:
+    ProfilerZone(const char* name): _name(name), _enabled(Profiler::isEnabled())
+    {
+        _start = _enabled ? Profiler::getTime() : 0;
+    }
+
+    ProfilerZone(const std::string& name): _enabled(Profiler::isEnabled())
+    {
+        _name = _enabled ? Profiler::internName(name) : nullptr;
+        _start = _enabled ? Profiler::getTime() : 0;
+    }
+
+    ~ProfilerZone()
+    {
+        if (_enabled)
+        {
+            Profiler::addEvent(_name, _start, Profiler::getTime());
+        }
+    }
+
+private:
+    const char*             _name;
+    bool                    _enabled;
+    uint64_t                _start;
+};
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <glm/vec3.hpp>
+#include <deque>
+#include <functional>
 #include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -15,10 +18,26 @@
 
 #define ARCHETYPES_LOCATION "resources/archetypes"
 
+#define ARCHETYPE_POOL_DEFAULT_MAX_SIZE 256
+
 class IComponentFactory;
 
 class EntityFactory
 {
+public:
+    struct sPoolStats
+    {
+        // Entities created with recycled components
+        uint32_t hits;
+        // Entities created by cloning the prototypes because the pool was empty
+        uint32_t misses;
+        uint32_t released;
+        // Released entities deleted because the pool was full
+        uint32_t discarded;
+        // Instances in the pool
+        uint32_t size;
+    };
+
 private:
     struct sEntityInfo
     {
@@ -26,6 +45,42 @@ private:
         std::list<std::string> components;
     };
 
+    // Components of the released entities of a pooled type
+    struct sPool
+    {
+        // Only the instances [0, stats.size[ are used, the others are kept to reuse their storage
+        std::vector<std::vector<sComponent*> > instances;
+        uint32_t maxSize;
+        sPoolStats stats;
+    };
+
+    // Entity acquired from a pool
+    struct sPooledEntity
+    {
+        Entity::sHandle handle;
+        uint32_t blueprintIndex;
+    };
+
+    // Archetype compiled by getBlueprint, so the entities are created without any string lookup
+    struct sBlueprint
+    {
+        std::string typeName;
+        // Template components of the archetype, owned by the components factories
+        std::vector<sComponent*> prototypes;
+        uint32_t tagId;
+        // IComponentFactory templates version of the compilation, 0 if the blueprint has to be compiled
+        uint32_t version;
+        // nullptr if the type is not pooled
+        std::unique_ptr<sPool> pool;
+    };
+
+public:
+    // Handle of a compiled archetype, it stays valid when the archetype is modified
+    struct sBlueprintHandle
+    {
+        uint32_t index;
+    };
+
 public:
     EntityFactory();
     ~EntityFactory();
@@ -35,8 +90,17 @@ public:
 
     static Entity*                                          createEntity(const std::string& typeName, bool store = true);
     static Entity*                                          createEntity(const std::string& typeName, const glm::vec3& pos, bool store = true);
+    static Entity*                                          createEntity(const sBlueprintHandle& blueprint, bool store = true);
+    static Entity*                                          createEntity(const sBlueprintHandle& blueprint, const glm::vec3& pos, bool store = true);
+    // Create one entity per position, the archetype is resolved once and the systems are notified once
+    static std::vector<Entity*>                             createEntities(const std::string& typeName, const std::vector<glm::vec3>& positions, bool store = true);
+
+    // Resolve the archetype, the handle can be cached to create entities of the type without strings lookups
+    static sBlueprintHandle                                 getBlueprint(const std::string& typeName);
 
     static void                                             bindEntityManager(EntityManager* em);
+    // Forget the entities acquired in the entity manager, called before it is destroyed
+    static void                                             removeEntityManager(EntityManager* em);
     static EntityManager*                                   getBindedEntityManager();
 
     static void                                             createEntityType(const std::string& typeName);
@@ -56,12 +120,47 @@ public:
     static void                                             reverseAnimations(Entity* entity);
 
     static Entity*                                          cloneEntity(const std::string& typeName, bool store = true);
-
+    static Entity*                                          cloneEntity(const sBlueprintHandle& blueprint, bool store = true);
+
+    // Opt-in pooling of the entities of the type: the components of the released entities are kept
+    // and reset with the prototypes (See sComponent::reset) to create the next entities of the type
+    // warmSize instances are created now and at most maxSize instances are kept
+    static void                                             enablePooling(const std::string& typeName,
+                                                                            uint32_t warmSize = 0,
+                                                                            uint32_t maxSize = ARCHETYPE_POOL_DEFAULT_MAX_SIZE);
+    // Create an entity with recycled components if the pool of the type is not empty
+    // createEntity and cloneEntity acquire the entities of the pooled types
+    static Entity*                                          acquire(const sBlueprintHandle& blueprint, bool store = true);
+    // Destroy the entity at the next EntityManager::flushCommands
+    // The components of an entity acquired from a pool return to the pool
+    // Thread safe, the pools are only updated by the flush
+    static void                                             release(EntityManager& em, Entity* entity);
+    // Release the entity of the binded entity manager
+    static void                                             release(Entity* entity);
+    // Delete the components kept by the pools, called at shutdown
+    static void                                             clearPools();
+    static void                                             forEachPool(const std::function<void (const std::string& typeName, const sPoolStats& stats)>& callback);
+
+    // Clone all the entities of src in dst (used to play the editor level)
+    // The systems of dst are notified once all the entities are cloned
     static void                                             copyEntityManager(EntityManager* dst, EntityManager* src);
 
     static void                                             saveEntityTemplateToJson(const std::string& typeName);
     static void                                             saveEntityTemplate(const std::string& typeName, Entity* entity);
 
+private:
+    // Compile the blueprint if the archetype has been modified
+    static sBlueprint&                                      getCompiledBlueprint(const sBlueprintHandle& blueprint);
+    static void                                             invalidateBlueprint(const std::string& typeName);
+
+    // Create the entity with the components (cloned or recycled) of the blueprint
+    static Entity*                                          instantiate(const sBlueprint& blueprint, const std::vector<sComponent*>& components, bool store);
+    // Match the recycled components with the prototypes and reset them
+    static void                                             resetComponents(const sBlueprint& blueprint, std::vector<sComponent*>& components);
+    // Called by the EntityManager command buffer with the components of a released entity
+    // The components of the entities which are not pooled are deleted
+    static void                                             recycle(EntityManager* em, const Entity::sHandle& handle, std::vector<sComponent*>& components);
+
 private:
     // Store entities components names (ComponentFactory has components)
     static std::unordered_map<std::string, sEntityInfo>     _entities;
@@ -70,4 +169,12 @@ private:
 
     // Entity types file definition
     static std::unordered_map<std::string, std::string>     _entitiesFiles;
+
+    // Blueprints indexed by handle, never removed so the handles stay valid
+    // Use a deque so the compiled blueprints references are not invalidated when a blueprint is added
+    static std::deque<sBlueprint>                           _blueprints;
+    static std::unordered_map<std::string, uint32_t>        _blueprintsIndices;
+
+    // Entities acquired from the pools of each entity manager, indexed by entity handle index
+    static std::unordered_map<EntityManager*, std::vector<sPooledEntity> > _pooledEntities;
 };
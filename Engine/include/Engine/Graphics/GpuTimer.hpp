@@ -0,0 +1,102 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <GL/glew.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Frames in flight, the queries of a frame are read when its slot is reused
+#define GPU_TIMER_FRAMES_NB         3
+// Weight of the last frame in the passes average time
+#define GPU_TIMER_AVERAGE_FACTOR    0.05f
+
+/*
+** Measure the GPU time of the render passes with timestamp queries.
+** The queries of a frame are read GPU_TIMER_FRAMES_NB frames later without waiting for the GPU,
+** the results which are not available yet are dropped.
+** The zones can be nested (the texts are rendered in the scene pass) and
+** a zone begun several times in a frame (one scene pass for each camera) is summed.
+*/
+class GpuTimer
+{
+public:
+    struct sPassStats
+    {
+        // String literal given to begin()
+        const char*             name;
+        // Nanoseconds
+        uint64_t                lastTime;
+        float                   avgTime;
+    };
+
+private:
+    struct sZoneQueries
+    {
+        uint32_t                passIdx;
+        GLuint                  beginQuery;
+        GLuint                  endQuery;
+    };
+
+    struct sFrame
+    {
+        std::vector<GLuint>     queries;
+        uint32_t                queriesNb;
+        std::vector<sZoneQueries> zones;
+
+        // Timestamps taken at the beginning of the frame to convert the GPU times in profiler times
+        int64_t                 cpuTime;
+        int64_t                 gpuTime;
+    };
+
+public:
+    GpuTimer();
+    ~GpuTimer();
+
+    // Return false if the timer queries are not supported, the zones are ignored
+    bool                        init();
+    bool                        isSupported() const;
+
+    void                        beginFrame();
+
+    // Return the zone index to give to end()
+    uint32_t                    begin(const char* name);
+    void                        end(uint32_t zoneIdx);
+
+    const std::vector<sPassStats>& getPassesStats() const;
+
+private:
+    void                        readFrame(sFrame& frame);
+    GLuint                      getQuery(sFrame& frame);
+    uint32_t                    getPassIdx(const char* name);
+
+private:
+    bool                        _supported;
+
+    std::array<sFrame, GPU_TIMER_FRAMES_NB> _frames;
+    uint32_t                    _frameIdx;
+
+    std::vector<sPassStats>     _passesStats;
+    std::vector<uint64_t>       _passesTimes;
+};
+
+/*
+** Measure the GPU time of a pass for the lifetime of the zone
+*/
+class GpuTimerZone
+{
+public:
+    GpuTimerZone(GpuTimer& timer, const char* name): _timer(timer), _zoneIdx(timer.begin(name)) {}
+
+    ~GpuTimerZone()
+    {
+        _timer.end(_zoneIdx);
+    }
+
+private:
+    GpuTimer&                   _timer;
+    uint32_t                    _zoneIdx;
+};
@@ -12,6 +12,7 @@
 #include <Engine/Core/Components/RenderComponent.hh>
 #include <Engine/Graphics/Camera.hpp>
 #include <Engine/Graphics/Framebuffer.hpp>
+#include <Engine/Graphics/GpuTimer.hpp>
 #include <Engine/Graphics/Light.hpp>
 #include <Engine/Graphics/Material.hpp>
 #include <Engine/Graphics/ModelInstance.hpp>
@@ -43,6 +44,8 @@ public:
     void                                endFrame();
     void                                render(Camera* camera, RenderQueue& renderQueue);
 
+    const GpuTimer&                     getGpuTimer() const;
+
     std::unique_ptr<Texture>            generateTextureFromModel(sRenderComponent* renderComponent, uint32_t width, uint32_t height);
 
 private:
@@ -93,6 +96,8 @@ private:
     // Singleton instance
     static std::shared_ptr<Renderer>    _instance;
 
+    GpuTimer                            _gpuTimer;
+
     Camera*                             _currentCamera;
     Camera                              _UICamera;
     Camera                              _defaultCamera;
@@ -20,7 +20,7 @@ public:
 
 public:
     Transform();
-    ~Transform() = default;
+    virtual ~Transform() = default;
 
     const glm::mat4&    getTransform();
 
@@ -48,6 +48,10 @@ private:
     void                updateDirection();
     void                updateTransform();
 
+protected:
+    // Called each time the transform is modified
+    virtual void        onTransformChanged() {}
+
 protected:
     glm::mat4           _transform = glm::mat4(1.0f);
     glm::vec3           _scale{1.0f, 1.0f, 1.0f};
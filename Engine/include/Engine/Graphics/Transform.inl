@@ -15,6 +15,7 @@ inline void    Transform::needUpdate()
 {
     _needUpdateTransform = true;
     _dirty = true;
+    onTransformChanged();
 }
 
 inline bool    Transform::isDirty()
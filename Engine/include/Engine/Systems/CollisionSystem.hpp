@@ -6,9 +6,17 @@
 
 #include <ECS/System.hpp>
 
+struct sRigidBodyComponent;
+
 START_SYSTEM(CollisionSystem)
 public:
     CollisionSystem();
     virtual ~CollisionSystem() {};
     virtual void    update(EntityManager &em, float elapsedTime);
+
+private:
+    // Set the collision state of rigidBody with other to ENTERING_COLLISION
+    // A new collision is removed from rigidBody when other is destroyed
+    void            enterCollision(EntityManager &em, Entity* entity, sRigidBodyComponent* rigidBody, Entity* other);
+    void            exitCollision(sRigidBodyComponent* rigidBody, Entity* other);
 END_SYSTEM(CollisionSystem)
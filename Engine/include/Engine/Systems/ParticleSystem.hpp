@@ -4,12 +4,16 @@
 
 #pragma once
 
+#include <random>
 #include <unordered_map>
 #include <vector>
 
 #include <ECS/Entity.hpp>
 #include <ECS/System.hpp>
 
+#include <Engine/Core/Components/ParticleEmitterComponent.hh>
+#include <Engine/Core/Components/RenderComponent.hh>
+
 #include <Engine/Graphics/BufferPool.hpp>
 #include <Engine/Graphics/Model.hpp>
 #include <Engine/Graphics/Geometries/Geometry.hpp>
@@ -44,6 +48,8 @@ struct sEmitter
     unsigned int            particlesNb;
     float                   life;
     float                   elapsedTime;
+    // The entity is destroyed at the next flush of the commands
+    bool                    released;
 
     // Instance ubo
     BufferPool::SubBuffer*  buffer;
@@ -55,15 +61,25 @@ public:
     virtual ~ParticleSystem();
 
     virtual void    update(EntityManager &em, float elapsedTime);
+
+    bool            onEntityNewComponent(Entity* entity, sComponent* component) override final;
+    bool            onEntityRemovedComponent(Entity* entity, sComponent* component) override final;
+    bool            onEntityDeleted(Entity* entity) override final;
+
     std::unordered_map<Entity::sHandle, sEmitter*>* getEmitters();
 
 private:
     void            initEmitter(Entity* entity);
-    void            updateEmitter(EntityManager &em, Entity* entity, float elapsedTime);
+    void            updateEmitter(EntityManager &em, Entity* entity, sParticleEmitterComponent* emitterComp, sRenderComponent* render, float elapsedTime);
     void            removeEmitter(const Entity::sHandle& handle);
 
 private:
     std::unordered_map<Entity::sHandle, sEmitter*>     _emitters;
     bool                                        _editorMode;
     static std::unique_ptr<BufferPool>          _bufferPool;
+
+    // The system is updated on a worker, it can't use the shared random engine (See Maths::setRandomSeed)
+    std::default_random_engine                  _randomEngine;
+    // The replays set the seed after the states are created
+    uint32_t                                    _randomSeed;
 END_SYSTEM(ParticleSystem)
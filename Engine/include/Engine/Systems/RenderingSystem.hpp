@@ -48,6 +48,8 @@ public:
     void update(EntityManager& em, float elapsedTime) override final;
 
     void                                    attachCamera(Camera* camera);
+    // Position of the rendered frame between the last two fixed updates, in [0, 1] (See GameState::fixedUpdate)
+    void                                    setInterpolation(float interpolation);
 
 private:
     void                                    addParticlesToRenderQueue(EntityManager& em, float elapsedTime);
@@ -58,8 +60,11 @@ private:
     void                                    addCameraViewOrthoGraphicToRenderQueue(sCameraComponent* cameraComp, sTransformComponent* transform);
     void                                    addCameraViewToRenderQueue(sCameraComponent* cameraComp, sTransformComponent* transform);
 
-    void                                    addBatch(sTransformComponent* transform, sRenderComponent* render);
-    BufferPool::SubBuffer*                  getModelBuffer(sTransformComponent* transform, sRenderComponent* render);
+    void                                    addBatch(const glm::mat4& transform, sRenderComponent* render);
+    // The rigid bodies are rendered between their previous and current simulated positions
+    glm::mat4                               getInterpolatedTransform(Entity* entity, sTransformComponent* transform) const;
+    // Only upload the model buffer if the transform changed since the previous update
+    BufferPool::SubBuffer*                  getModelBuffer(sTransformComponent* transform, sRenderComponent* render, uint32_t changedSince);
     void                                    updateModelBuffer(BufferPool::SubBuffer* buffer, const glm::mat4& transform, const glm::vec4& color);
 
     void                                    updateColliderMaterial(ModelInstance* modelInstance, Entity* entity);
@@ -74,6 +79,11 @@ private:
 
     std::vector<sBatch> _batches;
 
+    // Version of the entity manager at the previous update (See EntityManager::nextVersion)
+    uint32_t                                    _lastVersion{0};
+
+    float                                       _interpolation{1.0f};
+
     // A camera can be attached to the RenderSystem
     // If no camera is attached, it will use the camera of an entity with sCameraComponent
     Camera*                                     _camera{nullptr};
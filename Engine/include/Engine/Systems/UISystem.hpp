@@ -6,7 +6,10 @@
 
 #include <ECS/System.hpp>
 
+#include <Engine/Core/Components/RenderComponent.hh>
 #include <Engine/Core/Components/TextComponent.hh>
+#include <Engine/Core/Components/TransformComponent.hh>
+#include <Engine/Core/Components/UiComponent.hh>
 #include <Engine/Debug/MonitoringDebugWindow.hpp>
 
 START_SYSTEM(UISystem)
@@ -20,6 +23,8 @@ public:
     void                                onWindowResize(EntityManager &em);
 
 private:
-    void                                handleAlignment(EntityManager& em, Entity* entity, bool forceUpdate = false);
+    // Align the UI entities which need it
+    void                                alignEntities(EntityManager& em, bool forceUpdate);
+    void                                handleAlignment(Entity* entity, sUiComponent* ui, sRenderComponent* render, sTransformComponent* transform, bool forceUpdate = false);
     void                                alignText(sTextComponent* textComp, const glm::vec3& uiSize);
 END_SYSTEM(UISystem)
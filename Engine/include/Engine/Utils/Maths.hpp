@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <random>
 
 class Maths
@@ -16,13 +17,29 @@ public:
     template <typename T>
     static T randomFrom(const T min, const T max)
     {
-        static std::random_device rdev;
-        static std::default_random_engine re(rdev());
+        return (randomFrom(_randomEngine, min, max));
+    }
+
+    // Draw from the random engine of a system which runs concurrently with the others
+    // The engine has to be seeded with getRandomSeed so the sessions can be replayed
+    template <typename T>
+    static T randomFrom(std::default_random_engine& randomEngine, const T min, const T max)
+    {
         typedef typename std::conditional<
             std::is_floating_point<T>::value,
             std::uniform_real_distribution<T>,
             std::uniform_int_distribution<T>>::type dist_type;
         dist_type uni(min, max);
-        return static_cast<T>(uni(re));
+        return static_cast<T>(uni(randomEngine));
     }
+
+    // The random numbers of the main thread (scripts, main thread systems...) come from the same engine,
+    // so a session can be replayed with the same seed (See InputRecorder)
+    // Not thread safe, the systems updated on the workers have their own engine seeded with getRandomSeed
+    static void         setRandomSeed(uint32_t seed);
+    static uint32_t     getRandomSeed();
+
+private:
+    static std::default_random_engine   _randomEngine;
+    static uint32_t                     _randomSeed;
 };
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #define SEC_TO_MS(s) ((s) * 1000)
 
 class Timer
@@ -18,5 +20,6 @@ public:
 private:
 	// Time since last reset
 	// getElapsedTime() return the elapsed time since last timer reset
-    float               _lastReset;
+    // Doesn't use glfwGetTime, GLFW is not initialized in headless mode
+    std::chrono::steady_clock::time_point _lastReset;
 };
@@ -51,6 +51,7 @@ public:
 
     bool                                hasLostFocus() const;
     void                                hasLostFocus(bool lostFocus);
+    bool                                isMinimized() const;
 
     Timer&                              getTimer();
 
@@ -0,0 +1,89 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define INPUT_RECORD_MAGIC      0x50524B54 // "TKRP"
+#define INPUT_RECORD_VERSION    1
+
+class GameWindow;
+
+/*
+** Record the input of each frame (keys and buttons states, cursor, scroll, typed text, focus)
+** with the frame elapsed time and the random seed in a binary file, and replay them.
+** During a replay, the live input is replaced by the recorded one after the window events are polled,
+** so the game states, the systems and the scripts run the same frames as the recorded session.
+** The file is written with the native endianness, it's replayed on the same platform.
+*/
+class InputRecorder
+{
+public:
+    enum class eMode: uint8_t
+    {
+        NONE,
+        RECORD,
+        REPLAY
+    };
+
+public:
+    InputRecorder();
+    ~InputRecorder();
+
+    // The random seed is generated and saved in the file
+    bool                        startRecording(const std::string& fileName);
+    // The file is entirely loaded so the replay doesn't read the disk during the frames
+    bool                        startReplay(const std::string& fileName);
+    void                        stop();
+
+    eMode                       getMode() const;
+    uint32_t                    getSeed() const;
+    uint32_t                    getFramesNb() const;
+
+    // Record the input and the elapsed time of the frame, or replace them with the replayed ones
+    // Return false when the replay is finished
+    bool                        updateFrame(GameWindow& window, float& elapsedTime);
+
+private:
+    void                        recordFrame(GameWindow& window, float elapsedTime);
+    bool                        replayFrame(GameWindow& window, float& elapsedTime);
+    // Return false if the record is truncated
+    bool                        readFrame(GameWindow& window, float& elapsedTime);
+
+    template<typename T>
+    void                        write(const T& value)
+    {
+        _file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool                        read(T& value)
+    {
+        if (_readPos + sizeof(T) > _data.size())
+        {
+            return (false);
+        }
+
+        std::memcpy(&value, _data.data() + _readPos, sizeof(T));
+        _readPos += sizeof(T);
+        return (true);
+    }
+
+private:
+    eMode                       _mode;
+    uint32_t                    _seed;
+    uint32_t                    _framesNb;
+
+    // Recording
+    std::ofstream               _file;
+
+    // Replay
+    std::vector<char>           _data;
+    size_t                      _readPos;
+};
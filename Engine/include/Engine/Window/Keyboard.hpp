@@ -9,10 +9,12 @@
 #include <unordered_map>
 
 class GameWindow;
+class InputRecorder;
 
 class Keyboard
 {
     friend GameWindow;
+    friend InputRecorder;
 
 public:
 	enum class          eKey : char
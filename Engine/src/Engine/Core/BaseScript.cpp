@@ -27,9 +27,8 @@ void BaseScript::Destroy()
         return;
     }
 
-    auto em = EntityFactory::getBindedEntityManager();
-
-    em->destroyEntityRegister(this->entity->handle);
+    // Pooled entities go back to their archetype pool
+    EntityFactory::release(this->entity);
 }
 
 void BaseScript::Destroy(Entity* entity)
@@ -39,9 +38,7 @@ void BaseScript::Destroy(Entity* entity)
         return;
     }
 
-    auto em = EntityFactory::getBindedEntityManager();
-
-    em->destroyEntityRegister(entity->handle);
+    EntityFactory::release(entity);
 }
 
 const std::vector<Entity*>& BaseScript::GetEntitiesByTag(const std::string& tag)
@@ -56,6 +53,11 @@ Entity* BaseScript::Instantiate(std::string type, glm::vec3 pos)
     return EntityFactory::createEntity(type, pos);
 }
 
+Entity* BaseScript::Instantiate(const EntityFactory::sBlueprintHandle& blueprint, glm::vec3 pos)
+{
+    return EntityFactory::createEntity(blueprint, pos);
+}
+
 const std::string&  BaseScript::getName() const
 {
     return (_name);
@@ -10,8 +10,13 @@
 
 #include <Engine/Core/Components/IComponentFactory.hpp>
 
+// Register the components types before anything else so their indices follow COMPONENTS_TYPES order
+static const uint32_t componentsTypesIndices[] = { COMPONENTS_TYPES(GENERATE_TYPES_INDICES) };
+
 std::unordered_map<std::string, IComponentFactory*>  IComponentFactory::_componentsTypes = { COMPONENTS_TYPES(GENERATE_PAIRS) };
 std::unordered_map<uint32_t, std::string>  IComponentFactory::_componentsTypesHashs = { COMPONENTS_TYPES(GENERATE_PAIRS_HASHS) };
+// Starts at 1, the blueprints version is 0 when they are not compiled
+uint32_t  IComponentFactory::_templatesVersion = 1;
 
 bool    IComponentFactory::componentTypeExists(const std::string& type)
 {
@@ -74,3 +79,8 @@ const std::unordered_map<uint32_t, std::string>& IComponentFactory::getComponent
 {
     return (_componentsTypesHashs);
 }
+
+uint32_t    IComponentFactory::getTemplatesVersion()
+{
+    return (_templatesVersion);
+}
@@ -32,6 +32,7 @@ sComponent* ComponentFactory<sRigidBodyComponent>::loadFromJson(const std::strin
         std::string ignoredTagString = ignoredTagJson.getString("tag", "");
         component->ignoredTags.push_back(ignoredTagString);
     }
+    component->updateIgnoredTagsMask();
 
     return (component);
 }
@@ -81,6 +82,7 @@ bool    ComponentFactory<sRigidBodyComponent>::updateEditor(const std::string& e
         if (ImGui::Button("New tag"))
         {
             component->ignoredTags.push_back("Default");
+            component->updateIgnoredTagsMask();
         }
     }
 
@@ -90,6 +92,7 @@ bool    ComponentFactory<sRigidBodyComponent>::updateEditor(const std::string& e
         component->ignoredTags.erase(component->ignoredTags.begin() + component->selectedTags);
         if (component->selectedTags >= component->ignoredTags.size())
             component->selectedTags--;
+        component->updateIgnoredTagsMask();
     }
 
     ImGui::BeginChild("Tags", ImVec2(0, 100), true);
@@ -117,9 +120,11 @@ bool    ComponentFactory<sRigidBodyComponent>::updateEditor(const std::string& e
         tagNameVec.push_back(0);
         tagNameVec.resize(64);
 
-        if (ImGui::InputText("Name", tagNameVec.data(), tagNameVec.size()))
+        // The tags are registered for the whole session, only register the name when the edition is validated
+        if (ImGui::InputText("Name", tagNameVec.data(), tagNameVec.size(), ImGuiInputTextFlags_EnterReturnsTrue))
         {
             component->ignoredTags[component->selectedTags] = (tagNameVec.data());
+            component->updateIgnoredTagsMask();
         }
     }
 
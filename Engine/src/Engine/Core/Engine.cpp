@@ -4,8 +4,11 @@
 
 #include <iostream>
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/EditorState.hpp>
+#include <Engine/EntityFactory.hpp>
 #include <Engine/Graphics/Geometries/GeometryFactory.hpp>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Debug/MenuBarDebugWindow.hpp>
 #include <Engine/Debug/EntitiesTemplateDebugWindow.hpp>
@@ -14,10 +17,12 @@
 #include <Engine/Debug/SoundEditorWindow.hpp>
 #include <Engine/Debug/LogDebugWindow.hpp>
 #include <Engine/Debug/MonitoringDebugWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <Engine/Debug/OverlayDebugWindow.hpp>
 #include <Engine/Debug/InspectorDebugWindow.hpp>
+#include <Engine/Utils/Helper.hpp>
 #include <Engine/Utils/LevelLoader.hpp>
-#include <Engine/Utils/Timer.hpp>
+#include <Engine/Utils/Maths.hpp>
 
 #include <Engine/Core/Engine.hpp>
 
@@ -34,6 +39,13 @@ bool    Engine::init()
         return (false);
     }
 
+    if (Headless::isEnabled())
+    {
+        // No window to show the logs
+        _logger->setStdoutEnabled(true);
+        LOG_INFO("Engine: Headless mode, no window, rendering and sound");
+    }
+
     _window = std::make_shared<GameWindow>(&_gameStateManager);
     if (!_window->initialize())
     {
@@ -63,27 +75,59 @@ bool    Engine::run(int ac, char** av, std::shared_ptr<GameState> startGameState
 {
     // FPS counter
     Timer&       timer = _window->getTimer();
-    float       timePerFrame;
 
     timer.reset();
-    timePerFrame = 1.0f / 60.0f;
+
+    // The random numbers of the recorded session are generated again from the start game state
+    if (_inputRecorder.getMode() != InputRecorder::eMode::NONE)
+    {
+        Maths::setRandomSeed(_inputRecorder.getSeed());
+    }
 
     // TODO: move initStartGameState and initDebugWindows in Engine::init
     // (need to find a way to initialize resources in Engine::init)
     if (!initStartGameState(startGameState) ||
-        !initDebugWindows(ac, av))
+        (!Headless::isEnabled() && !initDebugWindows(ac, av)))
         {
             return (false);
         }
 
+    _ticksTimer.reset();
+    _secondTicksTimer.reset();
+
     while (_window->isRunning())
     {
-        // Run one frame each 16ms
-        if (timer.getElapsedTime() >= timePerFrame)
         {
+            PROFILE_ZONE("Frame");
+
+            // Sleep until the next frame, the rate is throttled when the window is unfocused or minimized
+            {
+                PROFILE_ZONE("Wait next frame");
+                _framePacer.waitNextFrame(!_window->hasLostFocus(), _window->isMinimized());
+            }
+            MonitoringDebugWindow::getInstance()->updateFramePacing(_framePacer.getStats());
+
             float elapsedTime = timer.getElapsedTime();
             timer.reset();
-            _window->pollEvents();
+
+            // The simulation advances of a fixed time per tick, whatever the ticks rate
+            if (Headless::isEnabled())
+            {
+                elapsedTime = Headless::getTickTime();
+            }
+
+            {
+                PROFILE_ZONE("Poll events");
+                ALLOCATION_SCOPE("Engine: Poll events");
+                _window->pollEvents();
+            }
+
+            // Record the frame input or replace it with the recorded one
+            if (!_inputRecorder.updateFrame(*_window, elapsedTime))
+            {
+                LOG_INFO("Engine::run: End of the input replay");
+                break;
+            }
 
             _soundManager->update();
 
@@ -100,7 +144,13 @@ bool    Engine::run(int ac, char** av, std::shared_ptr<GameState> startGameState
 
             // Update state before debug windows because it can remove
             // states (So we don't want the removed state to update)
-            if (currentState->update(elapsedTime) == false)
+            bool updated;
+            {
+                PROFILE_ZONE("Game state update");
+                ALLOCATION_SCOPE("Engine: Game state update");
+                updated = currentState->update(elapsedTime);
+            }
+            if (updated == false)
             {
                 _gameStateManager.removeCurrentState();
                 auto &&currentState = _gameStateManager.getCurrentState();
@@ -109,6 +159,8 @@ bool    Engine::run(int ac, char** av, std::shared_ptr<GameState> startGameState
             // Update debug windows
             if (_gameStateManager.hasStates())
             {
+                PROFILE_ZONE("Debug windows");
+                ALLOCATION_SCOPE("Engine: Debug windows");
                 if (_debugWindows.size() > 0)
                 {
                     DebugWindow::applyGlobalStyle();
@@ -120,14 +172,51 @@ bool    Engine::run(int ac, char** av, std::shared_ptr<GameState> startGameState
                 }
             }
 
-            _renderer->endFrame();
+            {
+                ALLOCATION_SCOPE("Engine: Render");
+                _renderer->endFrame();
+            }
+
+            // Record the next frames and dump them in a trace file
+            if (_window->getKeyboard()[Keyboard::eKey::F12] == Keyboard::eKeyState::KEY_PRESSED)
+            {
+                Profiler::captureFrames(PROFILER_DEFAULT_CAPTURE_FRAMES);
+            }
+
+            // Dump the allocations of the last frame and the memory footprint of each tag
+            if (AllocationTracker::isEnabled() &&
+                _window->getKeyboard()[Keyboard::eKey::F11] == Keyboard::eKeyState::KEY_PRESSED)
+            {
+                AllocationTracker::dump(ALLOCATION_TRACKER_DEFAULT_DUMP_FILE);
+            }
+
+            if (Headless::isEnabled() && !updateHeadlessTicks())
+            {
+                _window->setRunning(false);
+            }
         }
+
+        // After the frame zone is closed
+        PROFILE_END_FRAME();
+        AllocationTracker::endFrame();
+    }
+
+    if (Headless::isEnabled())
+    {
+        reportHeadlessTicks();
+    }
+    if (AllocationTracker::isEnabled())
+    {
+        AllocationTracker::dump(ALLOCATION_TRACKER_DEFAULT_DUMP_FILE);
     }
     return (true);
 }
 
 bool    Engine::stop()
 {
+    _inputRecorder.stop();
+    // The pooled components are static and no EntityFactory instance frees them
+    EntityFactory::clearPools();
     _soundManager->shutdown();
     Logger::getInstance()->shutdown();
     return (true);
@@ -138,6 +227,16 @@ GameStateManager&   Engine::getGameStateManager()
     return (_gameStateManager);
 }
 
+FramePacer& Engine::getFramePacer()
+{
+    return (_framePacer);
+}
+
+InputRecorder&  Engine::getInputRecorder()
+{
+    return (_inputRecorder);
+}
+
 const std::vector<std::shared_ptr<DebugWindow>>&    Engine::getDebugWindows() const
 {
     return (_debugWindows);
@@ -205,8 +304,12 @@ bool    Engine::initDebugWindows(int ac, char** av)
 
 bool    Engine::initStartGameState(std::shared_ptr<GameState> startGameState)
 {
+    // The editor needs the rendering
     #if defined(ENGINE_DEBUG)
-        startGameState = std::make_shared<EditorState>(&_gameStateManager);
+        if (!Headless::isEnabled())
+        {
+            startGameState = std::make_shared<EditorState>(&_gameStateManager);
+        }
     #endif
 
     if (!_gameStateManager.addState(startGameState))
@@ -216,3 +319,26 @@ bool    Engine::initStartGameState(std::shared_ptr<GameState> startGameState)
 
     return (true);
 }
+
+bool    Engine::updateHeadlessTicks()
+{
+    _ticksNb++;
+    _secondTicksNb++;
+
+    float secondTime = _secondTicksTimer.getElapsedTime();
+    if (secondTime >= 1.0f)
+    {
+        LOG_INFO("Headless: %.1f ticks per second", _secondTicksNb / secondTime);
+        _secondTicksNb = 0;
+        _secondTicksTimer.reset();
+    }
+
+    return (Headless::getTicksLimit() == 0 || _ticksNb < Headless::getTicksLimit());
+}
+
+void    Engine::reportHeadlessTicks() const
+{
+    float totalTime = _ticksTimer.getElapsedTime();
+    LOG_INFO("Headless: %u ticks in %.3f s, %.1f ticks per second",
+            _ticksNb, totalTime, totalTime > 0.0f ? _ticksNb / totalTime : 0.0f);
+}
@@ -0,0 +1,177 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include <Engine/Core/FramePacer.hpp>
+
+// Keep the sleep estimate adaptive, the old sleeps weigh less when the count is halved
+#define SLEEP_ESTIMATE_MAX_SAMPLES  1000
+
+static double   toSeconds(const FramePacer::Clock::duration& duration)
+{
+    return (std::chrono::duration<double>(duration).count());
+}
+
+FramePacer::FramePacer():
+    _targetFps(FRAME_PACER_DEFAULT_FPS), _unfocusedFps(FRAME_PACER_DEFAULT_UNFOCUSED_FPS),
+    _minimizedFps(FRAME_PACER_DEFAULT_MINIMIZED_FPS), _sleepEstimate(0.005), _sleepMean(0.005),
+    _sleepM2(0), _sleepsNb(1), _stats{} {}
+
+FramePacer::~FramePacer() {}
+
+void    FramePacer::setTargetFps(float fps)
+{
+    _targetFps = std::max(fps, 0.0f);
+}
+
+void    FramePacer::setUnfocusedFps(float fps)
+{
+    _unfocusedFps = std::max(fps, 0.0f);
+}
+
+void    FramePacer::setMinimizedFps(float fps)
+{
+    _minimizedFps = std::max(fps, 0.0f);
+}
+
+float   FramePacer::getTargetFps() const
+{
+    return (_targetFps);
+}
+
+float   FramePacer::getUnfocusedFps() const
+{
+    return (_unfocusedFps);
+}
+
+float   FramePacer::getMinimizedFps() const
+{
+    return (_minimizedFps);
+}
+
+void    FramePacer::waitNextFrame(bool focused, bool minimized)
+{
+    Clock::time_point now = Clock::now();
+
+    if (!_started)
+    {
+        _started = true;
+        _nextDeadline = now;
+        _lastFrameStart = now;
+        _statsStart = now;
+    }
+
+    // The throttled rates never exceed the target rate
+    float fps = _targetFps;
+    float throttledFps = minimized ? _minimizedFps : (!focused ? _unfocusedFps : 0.0f);
+    if (throttledFps > 0.0f && (fps == 0.0f || throttledFps < fps))
+    {
+        fps = throttledFps;
+    }
+
+    Clock::time_point frameStart = now;
+    double jitter = 0;
+    if (fps > 0.0f)
+    {
+        Clock::duration frameDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps));
+        Clock::time_point deadline = _nextDeadline + frameDuration;
+
+        // More than a frame late (loading, window dragged...), don't run the missed frames in a burst
+        if (now > deadline + frameDuration)
+        {
+            deadline = now;
+            _missedDeadlinesNb++;
+        }
+        else if (now < deadline)
+        {
+            sleepUntil(deadline);
+        }
+
+        frameStart = Clock::now();
+        jitter = std::abs(toSeconds(frameStart - deadline));
+        _nextDeadline = deadline;
+    }
+    else
+    {
+        _nextDeadline = now;
+    }
+
+    updateStats(frameStart, jitter, toSeconds(frameStart - _lastFrameStart));
+    _lastFrameStart = frameStart;
+    _stats.targetFps = fps;
+}
+
+const FramePacer::sStats&   FramePacer::getStats() const
+{
+    return (_stats);
+}
+
+void    FramePacer::sleepUntil(const Clock::time_point& deadline)
+{
+    // Sleep 1 ms at a time while the sleep will end before the deadline
+    while (toSeconds(deadline - Clock::now()) > _sleepEstimate)
+    {
+        Clock::time_point sleepStart = Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        double sleepTime = toSeconds(Clock::now() - sleepStart);
+
+        _sleepTimeSum += sleepTime;
+        updateSleepEstimate(sleepTime);
+    }
+
+    // Spin the remaining time
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void    FramePacer::updateSleepEstimate(double sleepTime)
+{
+    // Welford online variance
+    _sleepsNb++;
+    double delta = sleepTime - _sleepMean;
+    _sleepMean += delta / _sleepsNb;
+    _sleepM2 += delta * (sleepTime - _sleepMean);
+
+    _sleepEstimate = _sleepMean + std::sqrt(_sleepM2 / (_sleepsNb - 1));
+
+    if (_sleepsNb >= SLEEP_ESTIMATE_MAX_SAMPLES)
+    {
+        _sleepsNb /= 2;
+        _sleepM2 /= 2;
+    }
+}
+
+void    FramePacer::updateStats(const Clock::time_point& frameStart, double jitter, double frameTime)
+{
+    _framesNb++;
+    _frameTimeSum += frameTime;
+    _jitterSum += jitter;
+    _jitterMax = std::max(_jitterMax, jitter);
+
+    double statsTime = toSeconds(frameStart - _statsStart);
+    if (statsTime < 1.0)
+    {
+        return;
+    }
+
+    _stats.framesNb = _framesNb;
+    _stats.avgFrameTime = (float)(_frameTimeSum / _framesNb);
+    _stats.avgJitter = (float)(_jitterSum / _framesNb);
+    _stats.maxJitter = (float)_jitterMax;
+    _stats.sleepPercent = (float)(100.0 * _sleepTimeSum / statsTime);
+    _stats.missedDeadlinesNb = _missedDeadlinesNb;
+
+    _statsStart = frameStart;
+    _framesNb = 0;
+    _frameTimeSum = 0;
+    _jitterSum = 0;
+    _jitterMax = 0;
+    _sleepTimeSum = 0;
+    _missedDeadlinesNb = 0;
+}
@@ -2,12 +2,17 @@
 * @Author   Guillaume Labey
 */
 
+#include <cmath>
+
+#include <Engine/Core/Components/RigidBodyComponent.hh>
+#include <Engine/Core/Components/TransformComponent.hh>
 #include <Engine/Core/GameStateManager.hpp>
 #include <Engine/Systems/RenderingSystem.hpp>
 #include <Engine/Utils/LevelLoader.hpp>
 #include <Engine/Debug/Debug.hpp>
 #include <Engine/Utils/Exception.hpp>
 #include <Engine/Debug/MonitoringDebugWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <Engine/Window/GameWindow.hpp>
 #include <Engine/EditorState.hpp>
 #include <Engine/EntityFactory.hpp>
@@ -18,7 +23,10 @@
 GameState::GameState(GameStateManager* gameStateManager, uint32_t id, const std::string& levelFile):
                     _gameStateManager(gameStateManager), _id(id), _levelFile(levelFile) {}
 
-GameState::~GameState() {}
+GameState::~GameState()
+{
+    EntityFactory::removeEntityManager(_world.getEntityManager());
+}
 
 bool    GameState::initSystems()
 {
@@ -37,12 +45,24 @@ bool    GameState::update(float elapsedTime)
 {
     try
     {
-        // Update GameState systems
-        for (auto&& system: _world.getSystems())
+        // Simulate with fixed time steps, then update the other systems once for the frame
+        float interpolation = fixedUpdate(elapsedTime * _timeSpeed);
+
+        RenderingSystem* renderingSystem = _world.getSystem<RenderingSystem>();
+        if (renderingSystem)
+        {
+            renderingSystem->setInterpolation(interpolation);
+        }
+
+        // Update GameState systems, the systems which don't conflict are updated concurrently
+        _world.update(elapsedTime * _timeSpeed);
+
+        auto& systems = _world.getSystems();
+        const auto& systemsTimes = _world.getScheduler().getSystemsTimes();
+        for (uint32_t i = 0; i < systems.size(); ++i)
         {
-            Timer timer;
-            system->update(*_world.getEntityManager(), elapsedTime * _timeSpeed);
-            MonitoringDebugWindow::getInstance()->updateSystem(system->getId(), timer.getElapsedTime(), system->getEntitiesNb(), system->getName());
+            System* system = systems[i].get();
+            MonitoringDebugWindow::getInstance()->updateSystem(system->getId(), systemsTimes[i], system->getEntitiesNb(), system->getName());
         }
     }
     catch(const Exception &e)
@@ -51,8 +71,11 @@ bool    GameState::update(float elapsedTime)
         return (false);
     }
 
-    // Destroy entities in destroy queue
-    _world.getEntityManager()->destroyEntities();
+    // Apply the entities changes recorded during the update (destroy queue...)
+    {
+        PROFILE_ZONE("EntityManager::flushCommands");
+        _world.getEntityManager()->flushCommands();
+    }
 
     return (true);
 }
@@ -67,6 +90,16 @@ float    GameState::getTimeSpeed() const
     return (_timeSpeed);
 }
 
+float   GameState::getFixedTimeStep() const
+{
+    return (_fixedTimeStep);
+}
+
+uint32_t    GameState::getMaxFixedStepsPerFrame() const
+{
+    return (_maxFixedStepsPerFrame);
+}
+
 World&  GameState::getWorld()
 {
     return (_world);
@@ -82,6 +115,16 @@ void    GameState::setTimeSpeed(float timeSpeed)
     _timeSpeed = timeSpeed;
 }
 
+void    GameState::setFixedTimeStep(float fixedTimeStep)
+{
+    _fixedTimeStep = fixedTimeStep;
+}
+
+void    GameState::setMaxFixedStepsPerFrame(uint32_t maxFixedSteps)
+{
+    _maxFixedStepsPerFrame = maxFixedSteps;
+}
+
 void    GameState::cloneEntityManager(EntityManager* em)
 {
     EntityFactory::copyEntityManager(_world.getEntityManager(), em);
@@ -150,6 +193,47 @@ void    GameState::loadLevel()
     }
 }
 
+float   GameState::fixedUpdate(float elapsedTime)
+{
+    if (!_world.hasFixedUpdateSystems())
+    {
+        return (1.0f);
+    }
+
+    _fixedTimeAccumulator += elapsedTime;
+
+    uint32_t fixedStepsNb = 0;
+    while (_fixedTimeAccumulator >= _fixedTimeStep && fixedStepsNb < _maxFixedStepsPerFrame)
+    {
+        PROFILE_ZONE("GameState::fixedUpdate step");
+        _world.fixedUpdate(_fixedTimeStep);
+        // The next step has to see the entities destroyed by this one (collisions callbacks...)
+        _world.getEntityManager()->flushCommands();
+        saveSimulatedPositions();
+
+        _fixedTimeAccumulator -= _fixedTimeStep;
+        fixedStepsNb++;
+    }
+
+    // The frame took too long (loading, breakpoint...), drop the steps not simulated
+    if (_fixedTimeAccumulator >= _fixedTimeStep)
+    {
+        _fixedTimeAccumulator = std::fmod(_fixedTimeAccumulator, _fixedTimeStep);
+    }
+
+    return (_fixedTimeAccumulator / _fixedTimeStep);
+}
+
+void    GameState::saveSimulatedPositions()
+{
+    EntityManager* em = _world.getEntityManager();
+
+    // Saved after all the fixed update systems, the CollisionSystem moves the bodies after the RigidBodySystem
+    em->view<sRigidBodyComponent, sTransformComponent>().each([](Entity* entity, sRigidBodyComponent* rigidBody, sTransformComponent* transform) {
+        rigidBody->simulatedPos = transform->getPos();
+    });
+}
+
 void    GameState::onWindowResize()
 {
     // Update UI system
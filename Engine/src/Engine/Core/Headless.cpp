@@ -0,0 +1,39 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <Engine/Core/Headless.hpp>
+
+bool        Headless::_enabled = false;
+uint32_t    Headless::_ticksLimit = 0;
+float       Headless::_tickTime = HEADLESS_DEFAULT_TICK_TIME;
+
+bool    Headless::isEnabled()
+{
+    return (_enabled);
+}
+
+void    Headless::setEnabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+uint32_t    Headless::getTicksLimit()
+{
+    return (_ticksLimit);
+}
+
+void    Headless::setTicksLimit(uint32_t ticksLimit)
+{
+    _ticksLimit = ticksLimit;
+}
+
+float   Headless::getTickTime()
+{
+    return (_tickTime);
+}
+
+void    Headless::setTickTime(float tickTime)
+{
+    _tickTime = tickTime;
+}
@@ -0,0 +1,265 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <new>
+
+#include <Engine/Debug/Logger.hpp>
+
+#include <Engine/Debug/AllocationTracker.hpp>
+
+std::array<AllocationTracker::sTag, ALLOCATION_TRACKER_MAX_TAGS> AllocationTracker::_tags;
+std::atomic<uint16_t>       AllocationTracker::_tagsNb(1);
+std::mutex                  AllocationTracker::_tagsMutex;
+thread_local uint16_t       AllocationTracker::_currentTag = ALLOCATION_TRACKER_UNTAGGED;
+
+std::atomic<int64_t>        AllocationTracker::_liveBytes(0);
+std::atomic<int64_t>        AllocationTracker::_peakLiveBytes(0);
+
+bool    AllocationTracker::isEnabled()
+{
+#if defined(ENGINE_ALLOCATION_TRACKER)
+    return (true);
+#else
+    return (false);
+#endif
+}
+
+uint16_t    AllocationTracker::registerTag(const char* name)
+{
+    std::lock_guard<std::mutex> lock(_tagsMutex);
+    uint16_t tagsNb = _tagsNb.load();
+
+    // The same name can be used by several scopes (resources loading...)
+    for (uint16_t i = 1; i < tagsNb; ++i)
+    {
+        if (std::strcmp(_tags[i].name, name) == 0)
+        {
+            return (i);
+        }
+    }
+
+    if (tagsNb == ALLOCATION_TRACKER_MAX_TAGS)
+    {
+        LOG_WARN("AllocationTracker::registerTag: Too many tags, the allocations of \"%s\" are untagged", name);
+        return (ALLOCATION_TRACKER_UNTAGGED);
+    }
+
+    _tags[tagsNb].name = name;
+    _tagsNb = tagsNb + 1;
+    return (tagsNb);
+}
+
+uint16_t    AllocationTracker::getCurrentTag()
+{
+    return (_currentTag);
+}
+
+uint16_t    AllocationTracker::setCurrentTag(uint16_t tag)
+{
+    uint16_t previousTag = _currentTag;
+
+    _currentTag = tag;
+    return (previousTag);
+}
+
+void    AllocationTracker::onAllocation(uint16_t tag, uint64_t size)
+{
+    sTag& allocationTag = _tags[tag];
+
+    allocationTag.allocationsNb.fetch_add(1, std::memory_order_relaxed);
+    allocationTag.bytes.fetch_add(size, std::memory_order_relaxed);
+    updatePeak(allocationTag.peakLiveBytes, allocationTag.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+    updatePeak(_peakLiveBytes, _liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+void    AllocationTracker::onFree(uint16_t tag, uint64_t size)
+{
+    _tags[tag].liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    _liveBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void    AllocationTracker::endFrame()
+{
+    uint16_t tagsNb = _tagsNb.load();
+
+    for (uint16_t i = 0; i < tagsNb; ++i)
+    {
+        sTag& tag = _tags[i];
+        sTagStats& stats = tag.stats;
+
+        stats.name = i == ALLOCATION_TRACKER_UNTAGGED ? "Untagged" : tag.name;
+        stats.frameAllocationsNb = tag.allocationsNb.exchange(0, std::memory_order_relaxed);
+        stats.frameBytes = tag.bytes.exchange(0, std::memory_order_relaxed);
+        stats.peakFrameAllocationsNb = std::max(stats.peakFrameAllocationsNb, stats.frameAllocationsNb);
+        stats.peakFrameBytes = std::max(stats.peakFrameBytes, stats.frameBytes);
+        stats.liveBytes = tag.liveBytes.load(std::memory_order_relaxed);
+        stats.peakLiveBytes = tag.peakLiveBytes.load(std::memory_order_relaxed);
+    }
+}
+
+void    AllocationTracker::forEachTag(const std::function<void (const sTagStats& stats)>& callback)
+{
+    uint16_t tagsNb = _tagsNb.load();
+
+    for (uint16_t i = 0; i < tagsNb; ++i)
+    {
+        // Not updated by endFrame yet
+        if (_tags[i].stats.name)
+            callback(_tags[i].stats);
+    }
+}
+
+int64_t     AllocationTracker::getLiveBytes()
+{
+    return (_liveBytes.load(std::memory_order_relaxed));
+}
+
+int64_t     AllocationTracker::getPeakLiveBytes()
+{
+    return (_peakLiveBytes.load(std::memory_order_relaxed));
+}
+
+void    AllocationTracker::dump(std::ostream& stream)
+{
+    stream << "Live: " << getLiveBytes() << " B (peak " << getPeakLiveBytes() << " B)" << std::endl;
+    stream << std::left << std::setw(40) << "Tag" << std::right
+        << std::setw(12) << "Allocs/frame" << std::setw(14) << "Bytes/frame"
+        << std::setw(12) << "Peak allocs" << std::setw(14) << "Peak bytes"
+        << std::setw(14) << "Live bytes" << std::setw(14) << "Peak live" << std::endl;
+
+    forEachTag([&stream](const sTagStats& stats) {
+        stream << std::left << std::setw(40) << stats.name << std::right
+            << std::setw(12) << stats.frameAllocationsNb << std::setw(14) << stats.frameBytes
+            << std::setw(12) << stats.peakFrameAllocationsNb << std::setw(14) << stats.peakFrameBytes
+            << std::setw(14) << stats.liveBytes << std::setw(14) << stats.peakLiveBytes << std::endl;
+    });
+}
+
+bool    AllocationTracker::dump(const std::string& fileName)
+{
+    std::ofstream file(fileName, std::ios::trunc);
+
+    if (!file.good())
+    {
+        LOG_ERROR("AllocationTracker::dump: Can't open \"%s\"", fileName.c_str());
+        return (false);
+    }
+
+    dump(file);
+    LOG_INFO("AllocationTracker: Allocations dumped in \"%s\"", fileName.c_str());
+    return (true);
+}
+
+void    AllocationTracker::updatePeak(std::atomic<int64_t>& peak, int64_t value)
+{
+    int64_t currentPeak = peak.load(std::memory_order_relaxed);
+
+    while (value > currentPeak && !peak.compare_exchange_weak(currentPeak, value, std::memory_order_relaxed)) {}
+}
+
+#if defined(ENGINE_ALLOCATION_TRACKER)
+
+// The size and the tag of the allocation are stored before the returned memory, which keeps the malloc alignment
+struct sAllocationHeader
+{
+    uint64_t        size;
+    uint16_t        tag;
+};
+
+#define ALLOCATION_HEADER_SIZE  ((sizeof(sAllocationHeader) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1))
+
+static void*    trackedAllocate(std::size_t size)
+{
+    char* memory = static_cast<char*>(std::malloc(ALLOCATION_HEADER_SIZE + size));
+
+    if (!memory)
+    {
+        return (nullptr);
+    }
+
+    sAllocationHeader* header = reinterpret_cast<sAllocationHeader*>(memory);
+    header->size = size;
+    header->tag = AllocationTracker::getCurrentTag();
+    AllocationTracker::onAllocation(header->tag, size);
+
+    return (memory + ALLOCATION_HEADER_SIZE);
+}
+
+static void     trackedFree(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    char* memory = static_cast<char*>(ptr) - ALLOCATION_HEADER_SIZE;
+    sAllocationHeader* header = reinterpret_cast<sAllocationHeader*>(memory);
+
+    AllocationTracker::onFree(header->tag, header->size);
+    std::free(memory);
+}
+
+void*   operator new(std::size_t size)
+{
+    void* ptr = trackedAllocate(size);
+
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void*   operator new[](std::size_t size)
+{
+    return (operator new(size));
+}
+
+void*   operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return (trackedAllocate(size));
+}
+
+void*   operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return (trackedAllocate(size));
+}
+
+void    operator delete(void* ptr) noexcept
+{
+    trackedFree(ptr);
+}
+
+void    operator delete[](void* ptr) noexcept
+{
+    trackedFree(ptr);
+}
+
+void    operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    trackedFree(ptr);
+}
+
+void    operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    trackedFree(ptr);
+}
+
+void    operator delete(void* ptr, std::size_t) noexcept
+{
+    trackedFree(ptr);
+}
+
+void    operator delete[](void* ptr, std::size_t) noexcept
+{
+    trackedFree(ptr);
+}
+
+#endif
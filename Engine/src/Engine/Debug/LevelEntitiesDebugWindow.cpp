@@ -139,7 +139,8 @@ void    LevelEntitiesDebugWindow::displayEntityDebug(EntityManager* em, Entity*
         entityTagVec.push_back(0);
         entityTagVec.resize(64);
 
-        if (ImGui::InputText("Tag", entityTagVec.data(), entityTagVec.size()))
+        // Each tag is registered for the whole session, only register the tag when the edition is validated
+        if (ImGui::InputText("Tag", entityTagVec.data(), entityTagVec.size(), ImGuiInputTextFlags_EnterReturnsTrue))
         {
             entity->setTag(entityTagVec.data());
         }
@@ -15,7 +15,7 @@
 std::shared_ptr<Logger> Logger::_instance;
 DECLARE_ENUM_MANAGER(Logger::eLogLevel)
 
-Logger::Logger()
+Logger::Logger(): _stdoutEnabled(false)
 {
     // TODO: Log only ERROR and WARN when LogDebugWindow filter work
     _logLevel =  eLogLevel::DEBUG | eLogLevel::INFO | eLogLevel::TRACE | eLogLevel::ERROR | eLogLevel::WARN;
@@ -89,6 +89,11 @@ void    Logger::log(Logger::eLogLevel level, const std::string& message)
             "]\t" << message << std::endl;
     }
 
+    if (_stdoutEnabled)
+    {
+        std::cout << "[" << EnumManager<Logger::eLogLevel>::enumToString(level) << "]\t" << message << std::endl;
+    }
+
 #if defined(ENGINE_DEBUG)
     std::stringstream log;
     log << "[" <<
@@ -123,6 +128,16 @@ Logger::eLogLevel   Logger::getLogLevel() const
     return (_logLevel);
 }
 
+void    Logger::setStdoutEnabled(bool stdoutEnabled)
+{
+    _stdoutEnabled = stdoutEnabled;
+}
+
+bool    Logger::isStdoutEnabled() const
+{
+    return (_stdoutEnabled);
+}
+
 void    Logger::addConsoleLog(const sLogInfo& logInfo)
 {
     if (!(_logLevel & logInfo.level))
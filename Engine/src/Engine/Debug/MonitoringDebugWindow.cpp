@@ -2,8 +2,13 @@
 * @Author   Julien Chardon
 */
 
+#include <ECS/ComponentAllocator.hpp>
+
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Debug/MonitoringDebugWindow.hpp>
+#include <Engine/EntityFactory.hpp>
+#include <Engine/Graphics/Renderer.hpp>
 
 
 std::shared_ptr<MonitoringDebugWindow>   MonitoringDebugWindow::_monitoringDebugWindow = nullptr;
@@ -45,6 +50,12 @@ void    MonitoringDebugWindow::build(std::shared_ptr<GameState> gameState, float
     if (resetCheckSec) // reset time record each 1s past
         _checkSec = 0;
 
+    displayFramePacing();
+    displayGpuPasses();
+    displayAllocations();
+    displayComponentsMemory();
+    displayEntityPools();
+
     ImGui::End();
 }
 
@@ -64,6 +75,11 @@ void    MonitoringDebugWindow::updateSystem(uint16_t key, float timeSec, uint32_
     _systemsRegistered[key].nbEntities = nbEntities;
 }
 
+void    MonitoringDebugWindow::updateFramePacing(const FramePacer::sStats& stats)
+{
+    _framePacing = stats;
+}
+
 float   MonitoringDebugWindow::calcTimeAverage(std::vector<float> timeLogs)
 {
     float avg = 0;
@@ -134,6 +150,94 @@ void    MonitoringDebugWindow::displaySystem(tMonitoring& system)
     ImGui::Separator(); // separate each display system
 }
 
+void    MonitoringDebugWindow::displayComponentsMemory()
+{
+    if (!ImGui::CollapsingHeader("Components memory"))
+        return;
+
+    for (const auto& stats : ComponentAllocator::getAllStats())
+    {
+        // Part of the allocations which reused a freed slot
+        float recycledPercent = stats.allocationsNb ? 100.0f * stats.recycledNb / stats.allocationsNb : 0.0f;
+
+        ImGui::Text("%s", FMT_MSG("%-28s | %5d (peak %5d) | %3d chunks of %4d B slots | %3.0f%% recycled", stats.name,
+            (int)stats.allocatedNb, (int)stats.peakAllocatedNb, (int)stats.chunksNb, (int)stats.slotSize, recycledPercent).c_str());
+    }
+}
+
+void    MonitoringDebugWindow::displayFramePacing()
+{
+    if (!ImGui::CollapsingHeader("Frame pacing"))
+        return;
+
+    if (_framePacing.targetFps > 0.0f)
+        ImGui::Text("%s", FMT_MSG("Target: %.0f fps", _framePacing.targetFps).c_str());
+    else
+        ImGui::Text("Target: unlimited");
+
+    ImGui::Text("%s", FMT_MSG("Frames: %d (avg %.2f ms) | %d missed deadlines", (int)_framePacing.framesNb,
+        SEC_TO_MS(_framePacing.avgFrameTime), (int)_framePacing.missedDeadlinesNb).c_str());
+    ImGui::Text("%s", FMT_MSG("Jitter: avg %.3f ms, max %.3f ms | %.0f%% sleeping", SEC_TO_MS(_framePacing.avgJitter),
+        SEC_TO_MS(_framePacing.maxJitter), _framePacing.sleepPercent).c_str());
+}
+
+void    MonitoringDebugWindow::displayGpuPasses()
+{
+    if (!ImGui::CollapsingHeader("GPU passes"))
+        return;
+
+    const GpuTimer& gpuTimer = Renderer::getInstance()->getGpuTimer();
+    if (!gpuTimer.isSupported())
+    {
+        ImGui::Text("Timer queries not supported");
+        return;
+    }
+
+    // The times are read a few frames late, the nested passes (texts) are included in their parent pass
+    for (const auto& stats : gpuTimer.getPassesStats())
+    {
+        ImGui::Text("%s", FMT_MSG("%-20s | %.3f ms (avg %.3f ms)", stats.name,
+            stats.lastTime / 1000000.0f, stats.avgTime / 1000000.0f).c_str());
+    }
+}
+
+void    MonitoringDebugWindow::displayAllocations()
+{
+    if (!ImGui::CollapsingHeader("Allocations"))
+        return;
+
+    if (!AllocationTracker::isEnabled())
+    {
+        ImGui::Text("Configure cmake with -DENGINE_ALLOCATION_TRACKER=ON to track the allocations");
+        return;
+    }
+
+    ImGui::Text("%s", FMT_MSG("Live: %.2f MB (peak %.2f MB) | F11 dumps in %s", AllocationTracker::getLiveBytes() / 1048576.0f,
+        AllocationTracker::getPeakLiveBytes() / 1048576.0f, ALLOCATION_TRACKER_DEFAULT_DUMP_FILE).c_str());
+
+    // Allocations of the last frame, peak of a frame and memory footprint of each tag
+    AllocationTracker::forEachTag([](const AllocationTracker::sTagStats& stats) {
+        ImGui::Text("%s", FMT_MSG("%-28s | %5d allocs %8d B / frame (peak %5d, %8d B) | live %.2f MB (peak %.2f MB)", stats.name,
+            (int)stats.frameAllocationsNb, (int)stats.frameBytes, (int)stats.peakFrameAllocationsNb, (int)stats.peakFrameBytes,
+            stats.liveBytes / 1048576.0f, stats.peakLiveBytes / 1048576.0f).c_str());
+    });
+}
+
+void    MonitoringDebugWindow::displayEntityPools()
+{
+    if (!ImGui::CollapsingHeader("Entity pools"))
+        return;
+
+    EntityFactory::forEachPool([](const std::string& typeName, const EntityFactory::sPoolStats& stats) {
+        // Part of the acquired entities which reused released components
+        uint32_t acquiredNb = stats.hits + stats.misses;
+        float hitPercent = acquiredNb ? 100.0f * stats.hits / acquiredNb : 0.0f;
+
+        ImGui::Text("%s", FMT_MSG("%-28s | %4d pooled | %3.0f%% hits (%d misses) | %d released (%d discarded)", typeName.c_str(),
+            (int)stats.size, hitPercent, (int)stats.misses, (int)stats.released, (int)stats.discarded).c_str());
+    });
+}
+
 // old display formating
 /*ImGui::Text(FMT_MSG("%-20s : %+2c %.2f ms (%.3f ms)", system.name.c_str(), (system.oldAvg < system.avgTimeSec) ? '+' : '-',
     SEC_TO_MS(system.avgTimeSec), SEC_TO_MS(system.timeSec)).c_str());*/
@@ -0,0 +1,196 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include <ECS/WorkerPool.hpp>
+
+#include <Engine/Debug/Logger.hpp>
+
+#include <Engine/Debug/Profiler.hpp>
+
+std::atomic<bool>           Profiler::_enabled(false);
+Profiler::Clock::time_point Profiler::_startTime = Profiler::Clock::now();
+
+std::mutex                  Profiler::_mutex;
+std::vector<std::unique_ptr<Profiler::sThreadBuffer> > Profiler::_threadsBuffers;
+thread_local Profiler::sThreadBuffer*   Profiler::_threadBuffer = nullptr;
+std::unordered_map<std::string, Profiler::sThreadBuffer*> Profiler::_tracksBuffers;
+std::unordered_set<std::string> Profiler::_names;
+
+uint32_t                    Profiler::_framesNb = 0;
+uint32_t                    Profiler::_captureFramesNb = 0;
+std::string                 Profiler::_captureFileName;
+
+bool    Profiler::isEnabled()
+{
+    return (_enabled.load(std::memory_order_relaxed));
+}
+
+void    Profiler::setEnabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+uint64_t    Profiler::getTime()
+{
+    return (std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _startTime).count());
+}
+
+void    Profiler::addEvent(const char* name, uint64_t start, uint64_t end)
+{
+    addEvent(getThreadBuffer(), name, start, end);
+}
+
+void    Profiler::addTrackEvent(const std::string& trackName, const char* name, uint64_t start, uint64_t end)
+{
+    sThreadBuffer* buffer = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tracksBuffers.find(trackName);
+
+        if (it == _tracksBuffers.end())
+        {
+            it = _tracksBuffers.emplace(trackName, createBuffer(trackName)).first;
+        }
+        buffer = it->second;
+    }
+
+    addEvent(buffer, name, start, end);
+}
+
+const char*     Profiler::internName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // The nodes of the set are not moved, the names pointers stay valid
+    return (_names.insert(name).first->c_str());
+}
+
+void    Profiler::captureFrames(uint32_t framesNb, const std::string& fileName)
+{
+#if !defined(ENGINE_PROFILER)
+    LOG_WARN("Profiler::captureFrames: The profiler zones are not compiled (ENGINE_NO_PROFILER)");
+    return;
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (auto& buffer: _threadsBuffers)
+        {
+            buffer->eventsNb = 0;
+        }
+    }
+
+    _framesNb = 0;
+    _captureFramesNb = framesNb;
+    _captureFileName = fileName;
+    setEnabled(framesNb != 0);
+}
+
+void    Profiler::endFrame()
+{
+    _framesNb++;
+
+    if (_captureFramesNb != 0 && _framesNb == _captureFramesNb)
+    {
+        setEnabled(false);
+        dumpChromeTrace(_captureFileName);
+        _captureFramesNb = 0;
+    }
+}
+
+bool    Profiler::dumpChromeTrace(const std::string& fileName)
+{
+    std::ofstream file(fileName, std::ios::trunc);
+
+    if (!file.good())
+    {
+        LOG_ERROR("Profiler::dumpChromeTrace: Can't open \"%s\"", fileName.c_str());
+        return (false);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint64_t eventsNb = 0;
+    bool first = true;
+
+    // Keep the nanoseconds of the microseconds timestamps
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const auto& buffer: _threadsBuffers)
+    {
+        file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id
+            << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+        first = false;
+
+        // The buffer is full, the oldest event is the next one overwritten
+        uint64_t bufferSize = buffer->events.size();
+        uint64_t begin = buffer->eventsNb > bufferSize ? buffer->eventsNb - bufferSize : 0;
+        for (uint64_t i = begin; i < buffer->eventsNb; ++i)
+        {
+            const sEvent& event = buffer->events[i % bufferSize];
+
+            // Complete events, the timestamps are in microseconds
+            file << ",\n{\"name\":\"";
+            writeEscapedString(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+                << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << event.duration / 1000.0 << "}";
+        }
+        eventsNb += buffer->eventsNb - begin;
+    }
+    file << "\n]}\n";
+
+    LOG_INFO("Profiler: %llu events dumped in \"%s\"", (unsigned long long)eventsNb, fileName.c_str());
+    return (true);
+}
+
+Profiler::sThreadBuffer*    Profiler::getThreadBuffer()
+{
+    if (_threadBuffer)
+    {
+        return (_threadBuffer);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t threadIndex = WorkerPool::getThreadIndex();
+
+    _threadBuffer = createBuffer(threadIndex == 0 ? "Main thread" : "Worker " + std::to_string(threadIndex));
+    return (_threadBuffer);
+}
+
+Profiler::sThreadBuffer*    Profiler::createBuffer(const std::string& name)
+{
+    std::unique_ptr<sThreadBuffer> buffer = std::make_unique<sThreadBuffer>();
+    sThreadBuffer* bufferPtr = buffer.get();
+
+    buffer->id = (uint32_t)_threadsBuffers.size();
+    buffer->name = name;
+    buffer->events.resize(PROFILER_EVENTS_PER_THREAD);
+    buffer->eventsNb = 0;
+
+    _threadsBuffers.push_back(std::move(buffer));
+    return (bufferPtr);
+}
+
+void    Profiler::addEvent(sThreadBuffer* buffer, const char* name, uint64_t start, uint64_t end)
+{
+    buffer->events[buffer->eventsNb % buffer->events.size()] = {name, start, end - start};
+    buffer->eventsNb++;
+}
+
+void    Profiler::writeEscapedString(std::ostream& stream, const char* str)
+{
+    for (; *str; ++str)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            stream << '\\';
+        }
+        stream << *str;
+    }
+}
@@ -11,6 +11,7 @@
 #include <Engine/Core/Components/TransformComponent.hh>
 #include <Engine/Debug/Debug.hpp>
 #include <Engine/Debug/Logger.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <Engine/Utils/Exception.hpp>
 #include <Engine/Utils/File.hpp>
 #include <Engine/Utils/Helper.hpp>
@@ -26,6 +27,9 @@ std::unordered_map<std::string, EntityFactory::sEntityInfo >  EntityFactory::_en
 std::unordered_map<std::string, std::string>  EntityFactory::_entitiesFiles;
 std::vector<const char*>  EntityFactory::_typesString;
 EntityManager*  EntityFactory::_em = nullptr;
+std::deque<EntityFactory::sBlueprint>  EntityFactory::_blueprints;
+std::unordered_map<std::string, uint32_t>  EntityFactory::_blueprintsIndices;
+std::unordered_map<EntityManager*, std::vector<EntityFactory::sPooledEntity> >  EntityFactory::_pooledEntities;
 
 EntityFactory::EntityFactory() {}
 
@@ -35,10 +39,13 @@ EntityFactory::~EntityFactory()
     {
         delete typeString;
     }
+
+    clearPools();
 }
 
 void EntityFactory::loadDirectory(const std::string& archetypesDir)
 {
+    PROFILE_ZONE("EntityFactory::loadDirectory");
     DIR* dir;
     struct dirent* ent;
 
@@ -157,6 +164,67 @@ Entity* EntityFactory::createEntity(const std::string& typeName, bool store)
     return (cloneEntity(typeName, store));
 }
 
+Entity* EntityFactory::createEntity(const sBlueprintHandle& blueprint, bool store)
+{
+    return (cloneEntity(blueprint, store));
+}
+
+Entity* EntityFactory::createEntity(const sBlueprintHandle& blueprint, const glm::vec3& pos, bool store)
+{
+    Entity *entity = cloneEntity(blueprint, store);
+
+    sTransformComponent* transform = entity->getComponent<sTransformComponent>();
+
+    transform->setPos(pos);
+
+    return (entity);
+}
+
+std::vector<Entity*>    EntityFactory::createEntities(const std::string& typeName, const std::vector<glm::vec3>& positions, bool store)
+{
+    const sBlueprint& blueprint = getCompiledBlueprint(getBlueprint(typeName));
+
+    for (sComponent* prototype : blueprint.prototypes)
+    {
+        ComponentPool* componentPool = _em->getComponentPool(prototype->id);
+        componentPool->reserve(componentPool->getSize() + (uint32_t)positions.size());
+    }
+    uint32_t transformTypeIndex = ComponentTypes::getIndex<sTransformComponent>();
+
+    if (store)
+    {
+        _em->reserveEntities((uint32_t)positions.size());
+    }
+
+    std::vector<Entity*> entities;
+    std::vector<sComponent*> components;
+    entities.reserve(positions.size());
+    for (const auto& pos : positions)
+    {
+        Entity* entity = _em->createEntity(store);
+        entity->setTag(blueprint.tagId);
+
+        components.clear();
+        for (sComponent* prototype : blueprint.prototypes)
+        {
+            sComponent* component = prototype->clone();
+            if (component->typeIndex == transformTypeIndex)
+            {
+                static_cast<sTransformComponent*>(component)->setPos(pos);
+            }
+            components.push_back(component);
+        }
+
+        _em->addComponents(entity, components);
+        initAnimations(entity);
+        entities.push_back(entity);
+    }
+
+    _em->notifyEntitiesCreated(entities);
+
+    return (entities);
+}
+
 void EntityFactory::createEntityType(const std::string& typeName)
 {
     // Add entity to factory
@@ -207,11 +275,64 @@ void EntityFactory::createEntityType(const std::string& typeName)
 
 }
 
+EntityFactory::sBlueprintHandle    EntityFactory::getBlueprint(const std::string& typeName)
+{
+    auto blueprintIndex = _blueprintsIndices.find(typeName);
+
+    if (blueprintIndex != _blueprintsIndices.end())
+        return {blueprintIndex->second};
+
+    if (_entities.find(typeName) == _entities.end())
+        EXCEPT(InvalidParametersException, "The entity type %s does not exist", typeName.c_str());
+
+    uint32_t index = (uint32_t)_blueprints.size();
+    _blueprints.push_back({typeName, {}, ENTITY_TAG_NONE, 0, nullptr});
+    _blueprintsIndices[typeName] = index;
+
+    return {index};
+}
+
+EntityFactory::sBlueprint&  EntityFactory::getCompiledBlueprint(const sBlueprintHandle& blueprintHandle)
+{
+    sBlueprint& blueprint = _blueprints[blueprintHandle.index];
+
+    // The archetype or its templates components have been modified
+    if (blueprint.version != IComponentFactory::getTemplatesVersion())
+    {
+        const sEntityInfo& entityInfo = _entities.at(blueprint.typeName);
+
+        blueprint.prototypes.clear();
+        for (auto &&component : entityInfo.components)
+        {
+            blueprint.prototypes.push_back(IComponentFactory::getFactory(component)->getComponent(blueprint.typeName));
+        }
+        blueprint.tagId = EntityTags::getId(entityInfo.tag);
+        blueprint.version = IComponentFactory::getTemplatesVersion();
+    }
+
+    return (blueprint);
+}
+
+void    EntityFactory::invalidateBlueprint(const std::string& typeName)
+{
+    auto blueprintIndex = _blueprintsIndices.find(typeName);
+
+    if (blueprintIndex != _blueprintsIndices.end())
+        _blueprints[blueprintIndex->second].version = 0;
+}
+
 void EntityFactory::bindEntityManager(EntityManager* em)
 {
+    // The pooled entities are indexed per entity manager, the game states bind their entity manager every frame
     _em = em;
 }
 
+void    EntityFactory::removeEntityManager(EntityManager* em)
+{
+    // A new entity manager can be allocated at the same address, its handles would match the old ones
+    _pooledEntities.erase(em);
+}
+
 EntityManager*  EntityFactory::getBindedEntityManager()
 {
     return _em;
@@ -235,16 +356,19 @@ const void   EntityFactory::removeComponent(const std::string& typeName, const s
     {
         components.erase(foundComponent);
     }
+    invalidateBlueprint(typeName);
 }
 
 const void   EntityFactory::addComponent(const std::string& typeName, const std::string& component)
 {
     _entities[typeName].components.push_back(component);
+    invalidateBlueprint(typeName);
 }
 
 const void   EntityFactory::setTag(const std::string& typeName, const std::string& tag)
 {
     _entities[typeName].tag = tag;
+    invalidateBlueprint(typeName);
 }
 
 const std::string& EntityFactory::getFile(const std::string& typeName)
@@ -254,45 +378,260 @@ const std::string& EntityFactory::getFile(const std::string& typeName)
 
 Entity* EntityFactory::cloneEntity(const std::string& typeName, bool store)
 {
-    Entity* clone = _em->createEntity(store);
-    auto entity = _entities.find(typeName);
+    return (cloneEntity(getBlueprint(typeName), store));
+}
 
-    if (entity == _entities.end())
-        EXCEPT(InvalidParametersException, "The entity type %s does not exist", typeName.c_str());
+Entity* EntityFactory::cloneEntity(const sBlueprintHandle& blueprintHandle, bool store)
+{
+    const sBlueprint& blueprint = getCompiledBlueprint(blueprintHandle);
 
-    clone->setTag(entity->second.tag);
+    if (blueprint.pool)
+        return (acquire(blueprintHandle, store));
 
-    for (auto &&component : entity->second.components)
+    std::vector<sComponent*> components;
+    components.reserve(blueprint.prototypes.size());
+    for (sComponent* prototype : blueprint.prototypes)
     {
-        sComponent* component_ = IComponentFactory::createComponent(typeName, component);
-        clone->addComponent(component_);
+        components.push_back(prototype->clone());
     }
 
+    return (instantiate(blueprint, components, store));
+}
+
+Entity* EntityFactory::instantiate(const sBlueprint& blueprint, const std::vector<sComponent*>& components, bool store)
+{
+    Entity* clone = _em->createEntity(store);
+
+    clone->setTag(blueprint.tagId);
+    _em->addComponents(clone, components);
+
     initAnimations(clone);
     _em->notifyEntityCreated(clone);
 
     return (clone);
 }
 
+void    EntityFactory::enablePooling(const std::string& typeName, uint32_t warmSize, uint32_t maxSize)
+{
+    sBlueprint& blueprint = getCompiledBlueprint(getBlueprint(typeName));
+
+    if (!blueprint.pool)
+    {
+        blueprint.pool = std::make_unique<sPool>();
+        blueprint.pool->stats = {};
+    }
+
+    sPool* pool = blueprint.pool.get();
+    pool->maxSize = maxSize;
+
+    // Warm the pool
+    warmSize = std::min(warmSize, maxSize);
+    for (; pool->stats.size < warmSize; ++pool->stats.size)
+    {
+        if (pool->stats.size == pool->instances.size())
+            pool->instances.emplace_back();
+
+        std::vector<sComponent*>& instance = pool->instances[pool->stats.size];
+        for (sComponent* prototype : blueprint.prototypes)
+        {
+            instance.push_back(prototype->clone());
+        }
+    }
+}
+
+Entity* EntityFactory::acquire(const sBlueprintHandle& blueprintHandle, bool store)
+{
+    sBlueprint& blueprint = getCompiledBlueprint(blueprintHandle);
+    sPool* pool = blueprint.pool.get();
+
+    if (!pool)
+        return (cloneEntity(blueprintHandle, store));
+
+    Entity* entity;
+    if (pool->stats.size == 0)
+    {
+        pool->stats.misses++;
+
+        std::vector<sComponent*> components;
+        components.reserve(blueprint.prototypes.size());
+        for (sComponent* prototype : blueprint.prototypes)
+        {
+            components.push_back(prototype->clone());
+        }
+        entity = instantiate(blueprint, components, store);
+    }
+    else
+    {
+        pool->stats.hits++;
+
+        // The instance storage stays in the pool, the recycling only happens in flushCommands
+        std::vector<sComponent*>& instance = pool->instances[--pool->stats.size];
+        resetComponents(blueprint, instance);
+        entity = instantiate(blueprint, instance, store);
+        instance.clear();
+    }
+
+    // The handles of the acquired entities are only valid in their entity manager
+    std::vector<sPooledEntity>& pooledEntities = _pooledEntities[_em];
+    uint32_t index = entity->handle.index;
+    if (index >= pooledEntities.size())
+        pooledEntities.resize(index + 1);
+    pooledEntities[index] = {entity->handle, blueprintHandle.index};
+
+    return (entity);
+}
+
+void    EntityFactory::release(Entity* entity)
+{
+    release(*_em, entity);
+}
+
+void    EntityFactory::release(EntityManager& em, Entity* entity)
+{
+    Entity::sHandle handle = entity->handle;
+
+    // The pools are only read by the recycling, in flushCommands on the main thread
+    EntityManager* entityManager = &em;
+    em.getCommandBuffer().recycleEntity(handle, [entityManager, handle](std::vector<sComponent*>& components) {
+        recycle(entityManager, handle, components);
+    });
+}
+
+void    EntityFactory::clearPools()
+{
+    for (auto& blueprint: _blueprints)
+    {
+        if (!blueprint.pool)
+            continue;
+
+        sPool* pool = blueprint.pool.get();
+        for (uint32_t i = 0; i < pool->stats.size; ++i)
+        {
+            for (sComponent* component: pool->instances[i])
+                delete component;
+            pool->instances[i].clear();
+        }
+        pool->stats.size = 0;
+    }
+
+    _pooledEntities.clear();
+}
+
+void    EntityFactory::forEachPool(const std::function<void (const std::string& typeName, const sPoolStats& stats)>& callback)
+{
+    for (const auto& blueprint: _blueprints)
+    {
+        if (blueprint.pool)
+            callback(blueprint.typeName, blueprint.pool->stats);
+    }
+}
+
+void    EntityFactory::resetComponents(const sBlueprint& blueprint, std::vector<sComponent*>& components)
+{
+    uint32_t prototypesNb = (uint32_t)blueprint.prototypes.size();
+
+    // Put the components in the prototypes order
+    for (uint32_t i = 0; i < prototypesNb; ++i)
+    {
+        sComponent* prototype = blueprint.prototypes[i];
+        auto component = std::find_if(components.begin() + i, components.end(), [prototype](sComponent* component_) {
+            return (component_->typeIndex == prototype->typeIndex);
+        });
+
+        // The component has been removed from the entity or added to the archetype
+        if (component == components.end())
+        {
+            components.insert(components.begin() + i, prototype->clone());
+        }
+        else
+        {
+            std::iter_swap(components.begin() + i, component);
+            components[i]->reset(prototype);
+        }
+    }
+
+    // Components added to the entity or removed from the archetype
+    for (uint32_t i = prototypesNb; i < components.size(); ++i)
+    {
+        delete components[i];
+    }
+    components.resize(prototypesNb);
+}
+
+void    EntityFactory::recycle(EntityManager* em, const Entity::sHandle& handle, std::vector<sComponent*>& components)
+{
+    auto pooledEntities = _pooledEntities.find(em);
+
+    // The entity has not been acquired from a pool
+    if (pooledEntities == _pooledEntities.end() ||
+        handle.index >= pooledEntities->second.size() ||
+        !(pooledEntities->second[handle.index].handle == handle))
+    {
+        for (sComponent* component: components)
+            delete component;
+        components.clear();
+        return;
+    }
+
+    sPooledEntity& pooledEntity = pooledEntities->second[handle.index];
+    sPool* pool = _blueprints[pooledEntity.blueprintIndex].pool.get();
+    pooledEntity.handle = 0;
+
+    pool->stats.released++;
+    if (pool->stats.size >= pool->maxSize)
+    {
+        pool->stats.discarded++;
+        for (sComponent* component: components)
+            delete component;
+        components.clear();
+        return;
+    }
+
+    if (pool->stats.size == pool->instances.size())
+        pool->instances.emplace_back();
+
+    // Keep the components, the command buffer gets the empty instance storage
+    pool->instances[pool->stats.size++].swap(components);
+}
+
 void    EntityFactory::copyEntityManager(EntityManager* dst, EntityManager* src)
 {
     auto& entities = src->getEntities();
+    std::vector<Entity*> cloneEntities;
+    std::vector<sComponent*> cloneComponents;
+
+    dst->reserveEntities((uint32_t)entities.size());
+    cloneEntities.reserve(entities.size());
     for (Entity* entity: entities)
     {
         Entity* cloneEntity = dst->createEntity();
 
-        cloneEntity->setTag(entity->getTag());
+        cloneEntity->setTag(entity->getTagId());
+        // Additional tags
+        if (entity->getTags().count() > 1)
+        {
+            for (uint32_t tagId = 0; tagId < ENTITY_TAGS_MAX; ++tagId)
+            {
+                if (entity->hasTag(tagId))
+                {
+                    cloneEntity->addTag(tagId);
+                }
+            }
+        }
 
-        auto& components = entity->getComponents();
-        for (auto& component : components)
+        // Add all the components at once so the views and systems are updated once per entity
+        cloneComponents.clear();
+        for (auto& component : entity->getComponents())
         {
-            sComponent* cloneComponent = component->clone();
-            cloneEntity->addComponent(cloneComponent);
+            cloneComponents.push_back(component->clone());
         }
+        dst->addComponents(cloneEntity, cloneComponents);
 
         initAnimations(cloneEntity);
-        _em->notifyEntityCreated(cloneEntity);
+        cloneEntities.push_back(cloneEntity);
     }
+
+    dst->notifyEntitiesCreated(cloneEntities);
 }
 
 void    EntityFactory::initAnimations(Entity* entity)
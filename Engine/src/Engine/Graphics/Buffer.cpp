@@ -4,10 +4,15 @@
 
 #include <GL/glew.h>
 
+#include <Engine/Core/Headless.hpp>
+
 #include <Engine/Graphics/Buffer.hpp>
 
-Buffer::Buffer()
+Buffer::Buffer(): _VAO(0), _VBO(0), _EBO(0)
 {
+    if (Headless::isEnabled())
+        return;
+
     glGenBuffers(1, &_VBO);
     glGenBuffers(1, &_EBO);
     glGenVertexArrays(1, &_VAO);
@@ -15,6 +20,9 @@ Buffer::Buffer()
 
 Buffer::~Buffer()
 {
+    if (Headless::isEnabled())
+        return;
+
     glDeleteBuffers(1, &_VBO);
     glDeleteBuffers(1, &_EBO);
     glDeleteVertexArrays(1, &_VAO);
@@ -22,6 +30,9 @@ Buffer::~Buffer()
 
 void    Buffer::bind() const
 {
+    if (Headless::isEnabled())
+        return;
+
     glBindVertexArray(_VAO);
 }
 
@@ -31,6 +42,9 @@ void    Buffer::updateData(Vertex* vertices, int verticesNb, GLuint* indices, in
     _verticesNb = verticesNb;
     _indicesNb = indicesNb;
 
+    if (Headless::isEnabled())
+        return;
+
     // Bind Vertex Array
     glBindVertexArray(_VAO);
 
@@ -2,9 +2,13 @@
 * @Author   Guillaume Labey
 */
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Graphics/BufferPool.hpp>
 #include <Engine/Debug/Debug.hpp>
 
+// Largest alignment required by the drivers, used when there is no OpenGL context
+#define HEADLESS_UBO_ALIGNMENT  256
+
 void BufferPool::SubBuffer::free()
 {
     chunk->freeSubBuffers.push_back(idx);
@@ -13,8 +17,9 @@ void BufferPool::SubBuffer::free()
 BufferPool::BufferPool(uint32_t countPerChunk, uint32_t subBufferSize, GLuint bufferType):
                         _countPerChunk(countPerChunk), _subBufferSize(subBufferSize), _bufferType(bufferType)
 {
-    GLint uboAlignment = 0;
-    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uboAlignment);
+    GLint uboAlignment = HEADLESS_UBO_ALIGNMENT;
+    if (!Headless::isEnabled())
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uboAlignment);
 
     ASSERT(uboAlignment != 0, "The alignment should not be 0 (Is opengl initialized ?)");
 
@@ -2,15 +2,23 @@
 * @Author   Guillaume Labey
 */
 
+#include <Engine/Core/Headless.hpp>
+
 #include <Engine/Graphics/Framebuffer.hpp>
 
-Framebuffer::Framebuffer()
+Framebuffer::Framebuffer(): _fbo(0)
 {
+    if (Headless::isEnabled())
+        return;
+
     glGenFramebuffers(1, &_fbo);
 }
 
 Framebuffer::~Framebuffer()
 {
+    if (Headless::isEnabled())
+        return;
+
     if (_hasDepthBuffer)
     {
         glDeleteRenderbuffers(1, &_depthBuffer);
@@ -40,11 +48,17 @@ Framebuffer& Framebuffer::operator=(Framebuffer&& framebuffer)
 
 void    Framebuffer::bind(GLenum target) const
 {
+    if (Headless::isEnabled())
+        return;
+
     glBindFramebuffer(target, _fbo);
 }
 
 void    Framebuffer::unBind(GLenum target) const
 {
+    if (Headless::isEnabled())
+        return;
+
     glBindFramebuffer(target, 0);
 }
 
@@ -77,6 +91,9 @@ void    Framebuffer::addColorAttachment(std::unique_ptr<Texture> texture)
 
 void    Framebuffer::setDepthAttachment(GLenum internalformat, GLsizei width, GLsizei height)
 {
+    if (Headless::isEnabled())
+        return;
+
     bind(GL_FRAMEBUFFER);
 
     if (!_hasDepthBuffer)
@@ -93,6 +110,9 @@ void    Framebuffer::setDepthAttachment(GLenum internalformat, GLsizei width, GL
 
 void    Framebuffer::setAttachment(GLuint attachmentId, std::unique_ptr<Texture>& texture)
 {
+    if (Headless::isEnabled())
+        return;
+
     texture->bind();
 
     bind(GL_FRAMEBUFFER);
@@ -101,6 +121,9 @@ void    Framebuffer::setAttachment(GLuint attachmentId, std::unique_ptr<Texture>
 
 bool    Framebuffer::isComplete() const
 {
+    if (Headless::isEnabled())
+        return (true);
+
     return (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
 }
 
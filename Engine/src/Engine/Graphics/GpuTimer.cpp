@@ -0,0 +1,196 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <algorithm>
+
+#include <Engine/Core/Headless.hpp>
+#include <Engine/Debug/Logger.hpp>
+#include <Engine/Debug/Profiler.hpp>
+
+#include <Engine/Graphics/GpuTimer.hpp>
+
+GpuTimer::GpuTimer(): _supported(false), _frameIdx(0)
+{
+    for (auto& frame: _frames)
+    {
+        frame.queriesNb = 0;
+        frame.cpuTime = 0;
+        frame.gpuTime = 0;
+    }
+}
+
+GpuTimer::~GpuTimer()
+{
+    for (auto& frame: _frames)
+    {
+        if (!frame.queries.empty())
+        {
+            glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+        }
+    }
+}
+
+bool    GpuTimer::init()
+{
+    _supported = false;
+    if (Headless::isEnabled() || (!GLEW_VERSION_3_3 && !GLEW_ARB_timer_query))
+    {
+        return (false);
+    }
+
+    // Some drivers expose the extension without a timestamp counter
+    GLint counterBits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+    if (counterBits == 0)
+    {
+        LOG_WARN("GpuTimer::init: The timestamp queries are not supported, the GPU passes are not timed");
+        return (false);
+    }
+
+    _supported = true;
+    return (true);
+}
+
+bool    GpuTimer::isSupported() const
+{
+    return (_supported);
+}
+
+void    GpuTimer::beginFrame()
+{
+    if (!_supported)
+    {
+        return;
+    }
+
+    // The slot of the oldest frame is reused
+    _frameIdx = (_frameIdx + 1) % GPU_TIMER_FRAMES_NB;
+    sFrame& frame = _frames[_frameIdx];
+
+    readFrame(frame);
+
+    frame.queriesNb = 0;
+    frame.zones.clear();
+    frame.cpuTime = (int64_t)Profiler::getTime();
+    glGetInteger64v(GL_TIMESTAMP, &frame.gpuTime);
+}
+
+uint32_t    GpuTimer::begin(const char* name)
+{
+    if (!_supported)
+    {
+        return (0);
+    }
+
+    sFrame& frame = _frames[_frameIdx];
+    sZoneQueries zone;
+
+    zone.passIdx = getPassIdx(name);
+    zone.beginQuery = getQuery(frame);
+    zone.endQuery = 0;
+    glQueryCounter(zone.beginQuery, GL_TIMESTAMP);
+
+    frame.zones.push_back(zone);
+    return ((uint32_t)frame.zones.size() - 1);
+}
+
+void    GpuTimer::end(uint32_t zoneIdx)
+{
+    if (!_supported)
+    {
+        return;
+    }
+
+    sFrame& frame = _frames[_frameIdx];
+    sZoneQueries& zone = frame.zones[zoneIdx];
+
+    zone.endQuery = getQuery(frame);
+    glQueryCounter(zone.endQuery, GL_TIMESTAMP);
+}
+
+const std::vector<GpuTimer::sPassStats>&   GpuTimer::getPassesStats() const
+{
+    return (_passesStats);
+}
+
+void    GpuTimer::readFrame(sFrame& frame)
+{
+    if (frame.zones.empty())
+    {
+        return;
+    }
+
+    // Don't stall the pipeline, the frame is dropped if the GPU is more than GPU_TIMER_FRAMES_NB frames late
+    for (const auto& zone: frame.zones)
+    {
+        // The zone is not ended
+        if (zone.endQuery == 0)
+        {
+            return;
+        }
+
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(zone.endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE)
+        {
+            return;
+        }
+    }
+
+    std::fill(_passesTimes.begin(), _passesTimes.end(), 0);
+    for (const auto& zone: frame.zones)
+    {
+        GLuint64 beginTime = 0;
+        GLuint64 endTime = 0;
+        glGetQueryObjectui64v(zone.beginQuery, GL_QUERY_RESULT, &beginTime);
+        glGetQueryObjectui64v(zone.endQuery, GL_QUERY_RESULT, &endTime);
+        endTime = std::max(endTime, beginTime);
+
+        _passesTimes[zone.passIdx] += endTime - beginTime;
+
+        if (Profiler::isEnabled())
+        {
+            int64_t start = std::max<int64_t>((int64_t)beginTime - frame.gpuTime + frame.cpuTime, 0);
+            Profiler::addTrackEvent("GPU", _passesStats[zone.passIdx].name, start, start + (endTime - beginTime));
+        }
+    }
+
+    for (uint32_t i = 0; i < _passesStats.size(); ++i)
+    {
+        sPassStats& stats = _passesStats[i];
+
+        stats.lastTime = _passesTimes[i];
+        if (stats.avgTime == 0.0f)
+            stats.avgTime = (float)stats.lastTime;
+        else
+            stats.avgTime += ((float)stats.lastTime - stats.avgTime) * GPU_TIMER_AVERAGE_FACTOR;
+    }
+}
+
+GLuint  GpuTimer::getQuery(sFrame& frame)
+{
+    if (frame.queriesNb == frame.queries.size())
+    {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.queries.push_back(query);
+    }
+
+    return (frame.queries[frame.queriesNb++]);
+}
+
+uint32_t    GpuTimer::getPassIdx(const char* name)
+{
+    for (uint32_t i = 0; i < _passesStats.size(); ++i)
+    {
+        if (_passesStats[i].name == name)
+        {
+            return (i);
+        }
+    }
+
+    _passesStats.push_back({name, 0, 0.0f});
+    _passesTimes.push_back(0);
+    return ((uint32_t)_passesStats.size() - 1);
+}
@@ -5,6 +5,7 @@
 #include <glm/gtc/type_ptr.hpp> // glm::value_ptr
 #include <glm/gtc/matrix_transform.hpp> // glm::translate
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Graphics/Renderer.hpp>
 #include <Engine/Window/GameWindow.hpp>
@@ -46,6 +47,10 @@ void    Model2DRenderer::initialize()
 
 std::unique_ptr<Texture>    Model2DRenderer::generateTextureFromModel(sRenderComponent* renderComponent, uint32_t width, uint32_t height)
 {
+    // Nothing is rendered, the texture only has the size
+    if (Headless::isEnabled())
+        return (std::make_unique<Texture>(width, height));
+
     float windowBufferWidth = (float)GameWindow::getInstance()->getBufferWidth();
     float windowBufferHeight = (float)GameWindow::getInstance()->getBufferHeight();
 
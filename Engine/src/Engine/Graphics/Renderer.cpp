@@ -10,6 +10,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <Engine/Core/Headless.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <Engine/Graphics/UI/Font.hpp>
 #include <Engine/Graphics/Material.hpp>
 #include <Engine/Utils/Exception.hpp>
@@ -49,6 +51,12 @@ std::shared_ptr<Renderer>   Renderer::getInstance()
 
 bool    Renderer::initialize()
 {
+    PROFILE_ZONE("Renderer::initialize");
+
+    // Nothing is rendered, the shaders and the frame buffers are not needed
+    if (Headless::isEnabled())
+        return (true);
+
     try
     {
         initTextRendering();
@@ -61,6 +69,7 @@ bool    Renderer::initialize()
         return (false);
     }
 
+    _gpuTimer.init();
 
     // Enable depth buffer
     glEnable(GL_DEPTH_TEST);
@@ -77,6 +86,9 @@ bool    Renderer::initialize()
 
 void    Renderer::onWindowResize()
 {
+    if (Headless::isEnabled())
+        return;
+
     _UICamera.updateViewport();
     _UICamera.updateUBO();
 
@@ -106,8 +118,20 @@ void    Renderer::setCurrentCamera(Camera* camera)
     _currentCamera = camera;
 }
 
+const GpuTimer&     Renderer::getGpuTimer() const
+{
+    return (_gpuTimer);
+}
+
 void    Renderer::beginFrame()
 {
+    PROFILE_ZONE("Renderer::beginFrame");
+
+    if (Headless::isEnabled())
+        return;
+
+    _gpuTimer.beginFrame();
+
     // Clear window screen
     glClear(GL_COLOR_BUFFER_BIT);
 
@@ -142,6 +166,11 @@ void    Renderer::beginFrame()
 
 void    Renderer::endFrame()
 {
+    PROFILE_ZONE("Renderer::endFrame");
+
+    if (Headless::isEnabled())
+        return;
+
     // Apply bloom and then blend the scene with bloom texture
     {
         glDisable(GL_DEPTH_TEST);
@@ -164,6 +193,9 @@ void    Renderer::render(Camera* camera, RenderQueue& renderQueue)
         _currentCamera = camera;
     }
 
+    if (Headless::isEnabled())
+        return;
+
     // All the renders will use the color attachments and the depth buffer of the framebuffer
     _framebuffer.use(GL_FRAMEBUFFER);
     sceneRenderPass(camera, renderQueue);
@@ -174,6 +206,9 @@ void    Renderer::render(Camera* camera, RenderQueue& renderQueue)
 
 void    Renderer::sceneRenderPass(Camera* camera, RenderQueue& renderQueue)
 {
+    PROFILE_ZONE("Renderer::sceneRenderPass");
+    GpuTimerZone gpuZone(_gpuTimer, "sceneRenderPass");
+
     _currentShaderProgram = nullptr;
 
     // Scene objects
@@ -261,6 +296,9 @@ void    Renderer::sceneRenderPass(Camera* camera, RenderQueue& renderQueue)
 // The transparency is dynamic objects transparency when behind static objects
 void    Renderer::transparencyPass(Camera* camera, RenderQueue& renderQueue)
 {
+    PROFILE_ZONE("Renderer::transparencyPass");
+    GpuTimerZone gpuZone(_gpuTimer, "transparencyPass");
+
     if (!camera)
         return;
 
@@ -459,6 +497,9 @@ void    Renderer::transparencyPass(Camera* camera, RenderQueue& renderQueue)
 void    Renderer::bloomPass(Texture* sceneColorAttachment,
                             const std::vector<std::array<Framebuffer, 2>>& blurFramebuffers)
 {
+    PROFILE_ZONE("Renderer::bloomPass");
+    GpuTimerZone gpuZone(_gpuTimer, "bloomPass");
+
     for (uint32_t i = 0; i < blurFramebuffers.size(); ++i)
     {
         auto& blurFramebuffer = blurFramebuffers[i];
@@ -541,6 +582,9 @@ void    Renderer::bloomPass(Texture* sceneColorAttachment,
 
 void    Renderer::finalBlendingPass()
 {
+    PROFILE_ZONE("Renderer::finalBlendingPass");
+    GpuTimerZone gpuZone(_gpuTimer, "finalBlendingPass");
+
     GLsizei windowBufferWidth = (GLsizei)GameWindow::getInstance()->getBufferWidth();
     GLsizei windowBufferHeight = (GLsizei)GameWindow::getInstance()->getBufferHeight();
 
@@ -745,6 +789,9 @@ void    Renderer::renderTransparentObjects(std::vector<sRenderableMesh>& meshs,
 void    Renderer::renderTexts(std::vector<sRenderableText>& texts,
                                 uint32_t textsNb)
 {
+    PROFILE_ZONE("Renderer::renderTexts");
+    GpuTimerZone gpuZone(_gpuTimer, "renderTexts");
+
     if (textsNb == 0)
         return;
 
@@ -4,6 +4,7 @@
 
 #include <GL/glew.h>
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Utils/EnumManager.hpp>
 #include <Engine/Utils/Exception.hpp>
@@ -14,10 +15,15 @@
 
 ShaderProgram::ShaderProgram()
 {
-    // Create shader program
-    _shaderProgram = glCreateProgram();
+    _shaderProgram = 0;
     _options = 0;
     _linked = false;
+
+    if (Headless::isEnabled())
+        return;
+
+    // Create shader program
+    _shaderProgram = glCreateProgram();
 }
 
 ShaderProgram::~ShaderProgram()
@@ -31,6 +37,9 @@ ShaderProgram::~ShaderProgram()
 
 void    ShaderProgram::attachShader(GLenum shaderType, const std::string& fileName, const std::vector<Material::eOption>& options)
 {
+    if (Headless::isEnabled())
+        return;
+
     // Get shader raw source code
     std::string shaderString = ResourceManager::getInstance()->getOrLoadResource<File>(fileName)->getContent();
 
@@ -73,13 +82,15 @@ void    ShaderProgram::attachShader(GLenum shaderType, const std::string& fileNa
 void    ShaderProgram::link()
 {
     ASSERT(_linked == false, "A ShaderProgram should not be linked 2 times");
+    _linked = true;
+
+    if (Headless::isEnabled())
+        return;
 
     // Attach shaders in one final shader program
     glLinkProgram(_shaderProgram);
 
     checkProgramError();
-
-    _linked = true;
 }
 
 void    ShaderProgram::setOptions(int options)
@@ -129,11 +140,17 @@ std::string     ShaderProgram::shaderNameFromType(GLenum shaderType) const
 
 void    ShaderProgram::use()
 {
+    if (Headless::isEnabled())
+        return;
+
     glUseProgram(_shaderProgram);
 }
 
 GLuint  ShaderProgram::getUniformLocation(const char* location)
 {
+    if (Headless::isEnabled())
+        return (0);
+
     auto uniform = _uniformLocations.find(location);
     if (uniform == _uniformLocations.end())
     {
@@ -146,5 +163,8 @@ GLuint  ShaderProgram::getUniformLocation(const char* location)
 
 GLuint  ShaderProgram::getUniformBlockIndex(const char* name) const
 {
+    if (Headless::isEnabled())
+        return (0);
+
     return (glGetUniformBlockIndex(_shaderProgram, name));
 }
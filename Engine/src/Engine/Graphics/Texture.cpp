@@ -8,22 +8,32 @@
 #include <stb_image/stb_image.h>
 
 #include <Engine/Utils/Exception.hpp>
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Debug/Logger.hpp>
 
 #include <Engine/Graphics/Texture.hpp>
 
-Texture::Texture(): _comp(0)
+Texture::Texture(): _texture(0), _comp(0)
 {
+    if (Headless::isEnabled())
+        return;
+
     glGenTextures(1, &_texture);
 }
 
-Texture::Texture(int width, int height): _width(width), _height(height), _comp(0)
+Texture::Texture(int width, int height): _texture(0), _width(width), _height(height), _comp(0)
 {
+    if (Headless::isEnabled())
+        return;
+
     glGenTextures(1, &_texture);
 }
 
 Texture::~Texture()
 {
+    if (Headless::isEnabled())
+        return;
+
     glDeleteTextures(1, &_texture);
 }
 
@@ -38,6 +48,9 @@ std::unique_ptr<Texture>    Texture::create(GLsizei width,
 {
     std::unique_ptr<Texture> texture = std::make_unique<Texture>(width, height);
 
+    if (Headless::isEnabled())
+        return (std::move(texture));
+
     texture->bind();
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, NULL);
     glGenerateMipmap(GL_TEXTURE_2D);
@@ -81,6 +94,10 @@ void    Texture::load(GLsizei width,
 {
     _width = width;
     _height = height;
+
+    if (Headless::isEnabled())
+        return;
+
     _data = data;
     bind();
 
@@ -103,12 +120,18 @@ void    Texture::load(GLsizei width,
 
 void    Texture::bind(GLenum unit) const
 {
+    if (Headless::isEnabled())
+        return;
+
     glActiveTexture(unit);
     glBindTexture(GL_TEXTURE_2D, _texture);
 }
 
 void    Texture::unBind() const
 {
+    if (Headless::isEnabled())
+        return;
+
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
@@ -4,18 +4,26 @@
 
 #include <cstring>
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Graphics/UniformBuffer.hpp>
 #include <Engine/Debug/Logger.hpp>
 
 UniformBuffer::UniformBuffer(): _UBO(0), _bindingPoint(0), _init(false), _size(0)
 {
     _bufferType = GL_UNIFORM_BUFFER;
+
+    if (Headless::isEnabled())
+        return;
+
     glGenBuffers(1, &_UBO);
 }
 
 
 UniformBuffer::~UniformBuffer()
 {
+    if (Headless::isEnabled())
+        return;
+
     glDeleteBuffers(1, &_UBO);
 }
 
@@ -25,6 +33,11 @@ void    UniformBuffer::init(uint32_t size, GLuint bufferType)
         return;
 
     _bufferType = bufferType;
+    _size = size;
+    _init = true;
+
+    if (Headless::isEnabled())
+        return;
 
     // Bind UBO to _bufferType type so that all calls to _bufferType use VBO
     glBindBuffer(_bufferType, _UBO);
@@ -34,9 +47,6 @@ void    UniformBuffer::init(uint32_t size, GLuint bufferType)
 
     // Unbind UBO
     glBindBuffer(_bufferType, 0);
-
-    _size = size;
-    _init = true;
 }
 
 void    UniformBuffer::update(void* data, uint32_t size, uint32_t offset)
@@ -47,6 +57,9 @@ void    UniformBuffer::update(void* data, uint32_t size, uint32_t offset)
         return;
     }
 
+    if (Headless::isEnabled())
+        return;
+
     // Bind UBO to _bufferType type so that all calls to _bufferType use VBO
     glBindBuffer(_bufferType, _UBO);
 
@@ -68,6 +81,9 @@ void    UniformBuffer::bind(uint32_t offset, uint32_t size)
     if (!size)
         size = _size;
 
+    if (Headless::isEnabled())
+        return;
+
     // Bind UBO
     glBindBufferRange(_bufferType, _bindingPoint, _UBO, offset, size);
 }
@@ -28,7 +28,7 @@ bool        Physics::raycast(const Ray& ray, Entity** hitEntity, std::vector<Ent
             sTransformComponent* transform = entity->getComponent<sTransformComponent>();
 
             // We can't select entity that is not displayed or has model not initialized
-            if (!render || !render->getModel() || render->ignoreRaycast || !render->enabled)
+            if (!render || !render->getModel() || render->ignoreRaycast || !render->isEnabled())
                 continue;
 
             // Model box collider position
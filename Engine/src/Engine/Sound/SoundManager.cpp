@@ -5,6 +5,7 @@
 #include <cmath>
 #include <iostream>
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Debug/Debug.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Utils/ResourceManager.hpp>
@@ -47,6 +48,10 @@ std::shared_ptr<SoundManager>   SoundManager::getInstance()
 
 bool    SoundManager::initialize()
 {
+    // No sound device, the sounds are registered but not loaded or played
+    if (Headless::isEnabled())
+        return (true);
+
     _result = FMOD::System_Create(&_system);
     if (errorCheck())
         return (false);
@@ -67,6 +72,9 @@ bool    SoundManager::initialize()
 
 void    SoundManager::update()
 {
+    if (!_system)
+        return;
+
     _result = _system->update();
     errorCheck();
 }
@@ -75,6 +83,10 @@ void    SoundManager::shutdown()
 {
     for (int i = 0; i < NB_MAX_SOUNDS; i++)
         freeSound(i);
+
+    if (!_system)
+        return;
+
     _result = _system->close();
     errorCheck();
     _result = _system->release();
@@ -97,7 +109,11 @@ void    SoundManager::freeSound(int id)
     if (_sounds[id].free == false)
     {
         _sounds[id].free = true;
+        if (!_sounds[id].sound)
+            return;
+
         _result = _sounds[id].sound->release();
+        _sounds[id].sound = nullptr;
         errorCheck();
     }
     else
@@ -127,6 +143,9 @@ int     SoundManager::registerSound(const std::string& name, eSoundType type)
             _sounds[i].name = name;
             _sounds[i].id = i;
 
+            if (!_system)
+                return (_sounds[i].id);
+
             if (type == eSoundType::BACKGROUND_SOUND /*|| type == eSoundType::NONE*/)
             {
                 //_sounds[i].type = eSoundType::BACKGROUND_SOUND;
@@ -160,6 +179,9 @@ void    SoundManager::playSound(int id)
         return;
     }
 
+    if (!_system)
+        return;
+
     _result = _system->playSound(_sounds[id].sound, 0, false, &_sounds[id].channel);
     errorCheck();
 
@@ -224,6 +246,9 @@ void    SoundManager::restartSound(int id)
         return;
     }
 
+    if (_sounds[id].channel == nullptr) // Not currently playing
+        return;
+
     _result = _sounds[id].channel->setPosition(0, 0);
     errorCheck();
 }
@@ -326,6 +351,9 @@ void    SoundManager::pauseAllChannels()
 {
     bool chanGrpState;
 
+    if (!_system)
+        return;
+
     _result = _allChannelsGroup->getPaused(&chanGrpState);
     errorCheck();
 
@@ -340,6 +368,9 @@ void    SoundManager::resumeAllChannels()
 {
     bool chanGrpState;
     
+    if (!_system)
+        return;
+
     _result = _allChannelsGroup->getPaused(&chanGrpState);
     errorCheck();
 
@@ -352,6 +383,9 @@ void    SoundManager::resumeAllChannels()
 // limits of volume ? (0.0f -> 1.0f ?)
 void    SoundManager::setVolumeAllChannels(float volume)
 {
+    if (!_system)
+        return;
+
     _result = _allChannelsGroup->setVolume(volume);
     errorCheck();
 }
@@ -414,7 +448,7 @@ void    SoundManager::setMuteBckgd(bool toMute)
 {
     for (int i = 0; i < NB_MAX_SOUNDS; ++i)
     {
-        if (!_sounds[i].free && _sounds[i].type == eSoundType::BACKGROUND_SOUND)
+        if (!_sounds[i].free && _sounds[i].type == eSoundType::BACKGROUND_SOUND && _sounds[i].channel)
         {
             _sounds[i].channel->setVolume((toMute == true) ? 0 : _sounds[i].volume);
             //_sounds[i].channel->stop();
@@ -426,7 +460,7 @@ void    SoundManager::setMuteSfx(bool toMute)
 {
     for (int i = 0; i < NB_MAX_SOUNDS; ++i)
     {
-        if (!_sounds[i].free && _sounds[i].type == eSoundType::DEFAULT_SOUND)
+        if (!_sounds[i].free && _sounds[i].type == eSoundType::DEFAULT_SOUND && _sounds[i].channel)
         {
             _sounds[i].channel->setVolume((toMute == true) ? 0 : _sounds[i].volume);
         }
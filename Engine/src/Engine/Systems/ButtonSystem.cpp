@@ -7,11 +7,13 @@
 
 #include <Engine/Core/Components/ButtonComponent.hh>
 #include <Engine/Core/Components/TransformComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Physics/Collisions.hpp>
 #include <Engine/Utils/LevelLoader.hpp>
 #include <Engine/Window/GameWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/ButtonSystem.hpp>
 
@@ -21,6 +23,11 @@ ButtonSystem::ButtonSystem(GameStateManager* gameStateManager): _gameStateManage
     addDependency<sButtonComponent>();
     addDependency<sTransformComponent>();
 
+    // The keyboard navigation follows the buttons creation order
+    _keepEntitiesOrder = true;
+    // Read the window inputs, call the buttons scripts and change the game states
+    setExclusive(true);
+
     _currentSelected = -1;
     _buttonHovered = false;
     setupSelectedIcon();
@@ -30,6 +37,9 @@ ButtonSystem::~ButtonSystem() {}
 
 void    ButtonSystem::update(EntityManager& em, float elapsedTime)
 {
+    PROFILE_ZONE("ButtonSystem::update");
+    ALLOCATION_SCOPE("ButtonSystem");
+
     uint32_t    nbEntities = (uint32_t)_entities.size();
 
     float       windowHeight = (float)GameWindow::getInstance()->getBufferHeight();
@@ -66,7 +76,7 @@ void    ButtonSystem::handleButtonMouseHover(EntityManager& em, Entity* entity,
     glm::vec2               pos = glm::vec2(transform->getPos()) - (size / 2.0f);
 
     // Check the mouse is in the button (2D AABB collision)
-    if (render->enabled == true && Collisions::pointVSAABB2D(cursorPos, pos, size))
+    if (render->isEnabled() == true && Collisions::pointVSAABB2D(cursorPos, pos, size))
     {
         removeSelected(em, _currentSelected);
         _currentSelected = entityIdx;
@@ -244,7 +254,7 @@ uint32_t    ButtonSystem::getNextButtonEnabled(EntityManager& em, uint32_t butto
     Entity* nextButtonEntity = em.getEntity(_entities[nextButtonIdx]);
     sButtonComponent* nextButton = nextButtonEntity->getComponent<sButtonComponent>();
 
-    if (nextButton->enabled)
+    if (nextButton->isEnabled())
     {
         return (nextButtonIdx);
     }
@@ -265,7 +275,7 @@ uint32_t    ButtonSystem::getPreviousButtonEnabled(EntityManager& em, uint32_t b
     Entity* prevButtonEntity = em.getEntity(_entities[prevButtonIdx]);
     sButtonComponent* prevButton = prevButtonEntity->getComponent<sButtonComponent>();
 
-    if (prevButton->enabled)
+    if (prevButton->isEnabled())
     {
         return (prevButtonIdx);
     }
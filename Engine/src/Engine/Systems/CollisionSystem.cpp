@@ -8,27 +8,42 @@
 #include <Engine/Core/Components/BoxColliderComponent.hh>
 #include <Engine/Core/Components/DynamicComponent.hh>
 #include <Engine/Core/Components/SphereColliderComponent.hh>
+#include <Engine/Core/Components/RenderComponent.hh>
 #include <Engine/Core/Components/RigidBodyComponent.hh>
 #include <Engine/Core/Components/TransformComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Graphics/Geometries/Geometry.hpp>
 #include <Engine/Physics/Collisions.hpp>
 #include <Engine/Window/GameWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/CollisionSystem.hpp>
 
 CollisionSystem::CollisionSystem()
 {
     this->addDependency<sRigidBodyComponent>();
-    this->addDependency<sDynamicComponent>();
+    this->addDependency<sDynamicComponent>(eAccess::READ);
+    // The transforms are moved to test the collisions and moved back
+    this->addAccess<sTransformComponent>(eAccess::WRITE);
+    this->addAccess<sSphereColliderComponent>(eAccess::READ);
+    this->addAccess<sBoxColliderComponent>(eAccess::READ);
+    this->addAccess<sRenderComponent>(eAccess::READ);
+    // The render component model is loaded the first time it's used
+    this->setMainThreadOnly(true);
+    // The collisions are tested with the rigid bodies velocities, updated at the same rate
+    this->setFixedUpdate(true);
 }
 
 void    CollisionSystem::update(EntityManager &em, float elapsedTime)
 {
+    PROFILE_ZONE("CollisionSystem::update");
+    ALLOCATION_SCOPE("CollisionSystem");
+
     const std::vector<Entity*>& entities = em.getEntitiesByComponent<sRigidBodyComponent>();
 
-    this->forEachEntity(em, [&](Entity* entity)
+    em.view<sRigidBodyComponent, sDynamicComponent>().each([&](Entity* entity, sRigidBodyComponent* rigidBody, sDynamicComponent* dynamic)
     {
         if (entity->getComponent<sSphereColliderComponent>() || entity->getComponent<sBoxColliderComponent>())
         {
@@ -38,13 +53,12 @@ void    CollisionSystem::update(EntityManager &em, float elapsedTime)
                 {
                     if (entity->handle != (*it)->handle)
                     {
-                        sRigidBodyComponent* rigidBody = entity->getComponent<sRigidBodyComponent>();
                         sRigidBodyComponent* rigidBodyB = (*it)->getComponent<sRigidBodyComponent>();
 
-                        if (std::find(rigidBody->ignoredTags.begin(), rigidBody->ignoredTags.end(), (*it)->getTag()) != rigidBody->ignoredTags.end())
+                        if ((rigidBody->ignoredTagsMask & (*it)->getTags()).any())
                             continue;
 
-                        if (std::find(rigidBodyB->ignoredTags.begin(), rigidBodyB->ignoredTags.end(), entity->getTag()) != rigidBodyB->ignoredTags.end())
+                        if ((rigidBodyB->ignoredTagsMask & entity->getTags()).any())
                             continue;
 
                         sTransformComponent* firstTransform = entity->getComponent<sTransformComponent>();
@@ -72,26 +86,18 @@ void    CollisionSystem::update(EntityManager &em, float elapsedTime)
                                     rigidBody->velocity = glm::vec3(0.0f);
                                 }
 
-                                if (rigidBody->collisions.find((*it)->handle) == rigidBody->collisions.end() || rigidBody->collisions[(*it)->handle] == eCollisionState::NO_COLLISION)
-                                {
-                                    rigidBody->collisions[(*it)->handle] = eCollisionState::ENTERING_COLLISION;
-                                }
+                                enterCollision(em, entity, rigidBody, *it);
                             }
 
-                            if (rigidBody->collisions[(*it)->handle] == eCollisionState::IS_COLLIDING)
-                                rigidBody->collisions[(*it)->handle] = eCollisionState::EXIT_COLLISION;
+                            exitCollision(rigidBody, *it);
 
                             if (colliding && (*it)->getComponent<sDynamicComponent>() == nullptr)
                             {
-                                if (rigidBodyB->collisions.find(entity->handle) == rigidBodyB->collisions.end() || rigidBodyB->collisions[entity->handle] == eCollisionState::NO_COLLISION)
-                                {
-                                    rigidBodyB->collisions[entity->handle] = eCollisionState::ENTERING_COLLISION;
-                                }
+                                enterCollision(em, *it, rigidBodyB, entity);
                             }
                             else if ((*it)->getComponent<sDynamicComponent>() == nullptr)
                             {
-                                if (rigidBodyB->collisions[entity->handle] == eCollisionState::IS_COLLIDING)
-                                    rigidBodyB->collisions[entity->handle] = eCollisionState::EXIT_COLLISION;
+                                exitCollision(rigidBodyB, entity);
                             }
                         }
                     }
@@ -100,3 +106,37 @@ void    CollisionSystem::update(EntityManager &em, float elapsedTime)
         }
     });
 }
+
+void    CollisionSystem::enterCollision(EntityManager &em, Entity* entity, sRigidBodyComponent* rigidBody, Entity* other)
+{
+    auto collision = rigidBody->collisions.find(other->handle);
+
+    if (collision == rigidBody->collisions.end())
+    {
+        rigidBody->collisions[other->handle] = eCollisionState::ENTERING_COLLISION;
+
+        // The observer is dropped if the entity is destroyed first
+        Entity::sHandle entityHandle = entity->handle;
+        em.observeEntityDestroyed(other->handle, [&em, entityHandle](const Entity::sHandle& otherHandle) {
+            sRigidBodyComponent* rigidBody = em.getEntity(entityHandle)->getComponent<sRigidBodyComponent>();
+            if (rigidBody)
+            {
+                rigidBody->collisions.erase(otherHandle);
+            }
+        }, entityHandle);
+    }
+    else if (collision->second == eCollisionState::NO_COLLISION)
+    {
+        collision->second = eCollisionState::ENTERING_COLLISION;
+    }
+}
+
+void    CollisionSystem::exitCollision(sRigidBodyComponent* rigidBody, Entity* other)
+{
+    auto collision = rigidBody->collisions.find(other->handle);
+
+    if (collision != rigidBody->collisions.end() && collision->second == eCollisionState::IS_COLLIDING)
+    {
+        collision->second = eCollisionState::EXIT_COLLISION;
+    }
+}
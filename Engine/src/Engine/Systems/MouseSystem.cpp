@@ -10,13 +10,22 @@
 #include <Engine/Physics/Collisions.hpp>
 #include <Engine/Physics/Physics.hpp>
 #include <Engine/Graphics/Renderer.hpp>
+#include <Engine/Debug/AllocationTracker.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/MouseSystem.hpp>
 
-MouseSystem::MouseSystem() {}
+MouseSystem::MouseSystem()
+{
+    // Read the window inputs and call the hovered entities scripts
+    this->setExclusive(true);
+}
 
 void MouseSystem::update(EntityManager &em, float elapsedTime)
 {
+    PROFILE_ZONE("MouseSystem::update");
+    ALLOCATION_SCOPE("MouseSystem");
+
     this->hoverEntity(em);
 }
 
@@ -82,30 +91,22 @@ Entity* MouseSystem::getHoveredUI(EntityManager &em)
     Entity* nearestUI = nullptr;
     int nearestLayer = INT_MAX;
 
-    std::vector<Entity*>    entities = em.getEntities();
+    auto&&      uiEntities = em.view<sUiComponent, sRenderComponent, sTransformComponent>().getEntries();
     float       windowHeight = (float)GameWindow::getInstance()->getBufferHeight();
     auto&&      cursor = GameWindow::getInstance()->getMouse().getCursor();
     glm::vec2   cursorPos = glm::vec2(cursor.getX(), windowHeight - cursor.getY());
 
-    for (Entity* entity : entities)
+    for (auto&& uiEntity : uiEntities)
     {
-        sUiComponent* ui = entity->getComponent<sUiComponent>();
-        if (!ui)
-        {
-            continue;
-        }
-        sRenderComponent* render = entity->getComponent<sRenderComponent>();
-        if (!render)
-        {
-            continue;
-        }
-
-        sTransformComponent*    transform = entity->getComponent<sTransformComponent>();
+        Entity*                 entity = uiEntity.entity;
+        sUiComponent*           ui = std::get<0>(uiEntity.components);
+        sRenderComponent*       render = std::get<1>(uiEntity.components);
+        sTransformComponent*    transform = std::get<2>(uiEntity.components);
         const glm::vec2&        size = glm::vec2(render->getModel()->getSize() * transform->getScale());
         glm::vec2               pos = glm::vec2(transform->getPos()) - (size / 2.0f);
 
         // Check the mouse is in the button (2D AABB collision)
-        if (render->enabled && !render->ignoreRaycast &&
+        if (render->isEnabled() && !render->ignoreRaycast &&
             render->display &&
             ui->layer < nearestLayer &&
             Collisions::pointVSAABB2D(cursorPos, pos, size))
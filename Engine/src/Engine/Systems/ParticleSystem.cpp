@@ -10,19 +10,42 @@
 #include <Engine/Core/Components/ParticleEmitterComponent.hh>
 #include <Engine/Core/Components/RenderComponent.hh>
 #include <Engine/Core/Components/TransformComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
+#include <Engine/Debug/Profiler.hpp>
+#include <Engine/EntityFactory.hpp>
 #include <Engine/Graphics/Geometries/Plane.hpp>
 #include <Engine/Systems/ParticleSystem.hpp>
-#include <Engine/Utils/Helper.hpp>
+#include <Engine/Utils/Maths.hpp>
 #include <Engine/Window/GameWindow.hpp>
 
 // We can't initialize the buffer pool because opengl is not initialized
 std::unique_ptr<BufferPool> ParticleSystem::_bufferPool = nullptr;
 
-ParticleSystem::ParticleSystem(bool editorMode): _editorMode(editorMode)
+// Same as Helper::randFloat with the random engine of the system, the variances edited can be negative
+static float    randFloat(std::default_random_engine& randomEngine, float from, float to)
 {
-    addDependency<sParticleEmitterComponent>();
-    addDependency<sRenderComponent>();
+    if (from == to)
+        return (0.0f);
+
+    return (Maths::randomFrom(randomEngine, std::min(from, to), std::max(from, to)));
+}
+
+// Same as Helper::randInt with the random engine of the system
+static int      randInt(std::default_random_engine& randomEngine, int from, int to)
+{
+    if (from == to)
+        return (0);
+
+    return (Maths::randomFrom(randomEngine, std::min(from, to), std::max(from, to)));
+}
+
+ParticleSystem::ParticleSystem(bool editorMode): _editorMode(editorMode), _randomEngine(Maths::getRandomSeed()), _randomSeed(Maths::getRandomSeed())
+{
+    addDependency<sParticleEmitterComponent>(eAccess::READ);
+    addDependency<sRenderComponent>(eAccess::READ);
+    addAccess<sTransformComponent>(eAccess::READ);
+    setAccessOwnEntitiesOnly(true);
 
     if (!_bufferPool)
     {
@@ -42,17 +65,16 @@ void    ParticleSystem::initEmitter(Entity* entity)
     emitter->particles.resize(MAX_PARTICLES);
     emitter->particlesNb = 0;
     emitter->elapsedTime = 0;
+    emitter->released = false;
     emitter->buffer = _bufferPool->allocate();
 
     _emitters[entity->handle] = emitter;
 }
 
 
-void    ParticleSystem::updateEmitter(EntityManager &em, Entity* entity, float elapsedTime)
+void    ParticleSystem::updateEmitter(EntityManager &em, Entity* entity, sParticleEmitterComponent* emitterComp, sRenderComponent* render, float elapsedTime)
 {
-    sParticleEmitterComponent *emitterComp = entity->getComponent<sParticleEmitterComponent>();
     sTransformComponent *transform = entity->getComponent<sTransformComponent>();
-    sRenderComponent *render = entity->getComponent<sRenderComponent>();
     sEmitter* emitter = _emitters[entity->handle];
 
     emitter->elapsedTime += elapsedTime;
@@ -97,9 +119,10 @@ void    ParticleSystem::updateEmitter(EntityManager &em, Entity* entity, float e
             if (_editorMode)  {
                 emitter->life = 0;
             }
-            else {
-                removeEmitter(entity->handle);
-                em.destroyEntityRegister(entity->handle);
+            // The emitter is removed by onEntityDeleted, on the main thread
+            else if (!emitter->released) {
+                emitter->released = true;
+                EntityFactory::release(em, entity);
             }
         }
     }
@@ -120,20 +143,20 @@ void    ParticleSystem::updateEmitter(EntityManager &em, Entity* entity, float e
         emitterOrientation = glm::rotate(emitterOrientation, glm::radians(transform->getRotation().x), glm::vec3(1.0f, 0.0f, 0.0f));
 
         sParticle particle;
-        float angle = Helper::randFloat(0, emitterComp->angleVariance);
+        float angle = randFloat(_randomEngine, 0.0f, emitterComp->angleVariance);
         float angleRadian = glm::radians(std::fmod(angle - emitterComp->angle, 360.0f));
 
         particle.pos = transform->getPos();
-        float theta = Helper::randFloat(0.0f, 1.0f) * (2.0f * glm::pi<float>());
-        float phi = (glm::pi<float>() / 2.0f) - (Helper::randFloat(0.0f, 1.0f) * angleRadian);
+        float theta = randFloat(_randomEngine, 0.0f, 1.0f) * (2.0f * glm::pi<float>());
+        float phi = (glm::pi<float>() / 2.0f) - (randFloat(_randomEngine, 0.0f, 1.0f) * angleRadian);
         particle.velocity.x = glm::cos(theta) * glm::cos(phi);
         particle.velocity.z = glm::sin(theta) * glm::cos(phi);
         particle.velocity.y =  glm::sin(phi);
 
         particle.velocity = glm::vec3(emitterOrientation * glm::vec4(particle.velocity, 0.0f));
 
-        particle.speed = emitterComp->speed + Helper::randFloat(0, emitterComp->speedVariance);
-        particle.life = emitterComp->life + Helper::randInt(0, emitterComp->lifeVariance);
+        particle.speed = emitterComp->speed + randFloat(_randomEngine, 0.0f, emitterComp->speedVariance);
+        particle.life = emitterComp->life + randInt(_randomEngine, 0, (int)emitterComp->lifeVariance);
 
         particle.color = emitterComp->colorStart;
         particle.colorStep = (emitterComp->colorFinish - emitterComp->colorStart) / glm::vec4((float)emitterComp->life);
@@ -151,52 +174,79 @@ void    ParticleSystem::updateEmitter(EntityManager &em, Entity* entity, float e
 
 void    ParticleSystem::removeEmitter(const Entity::sHandle& handle)
 {
-    sEmitter* emitter = _emitters[handle];
+    auto emitterIt = _emitters.find(handle);
+    if (emitterIt == _emitters.end())
+    {
+        return;
+    }
+
+    sEmitter* emitter = emitterIt->second;
 
     _bufferPool->free(emitter->buffer);
 
     // Delete emitter pointer
     delete emitter;
     // Remove emitter from map
-    _emitters.erase(_emitters.find(handle));
+    _emitters.erase(emitterIt);
 }
 
 void    ParticleSystem::update(EntityManager &em, float elapsedTime)
 {
-    uint32_t activeEmitters = 0;
-
-    // Iterate over particle emitters
-    forEachEntity(em, [&](Entity *entity) {
+    PROFILE_ZONE("ParticleSystem::update");
+    ALLOCATION_SCOPE("ParticleSystem");
 
+    if (_randomSeed != Maths::getRandomSeed())
+    {
+        _randomSeed = Maths::getRandomSeed();
+        _randomEngine.seed(_randomSeed);
+    }
 
-        // Emitter not initialized
+    // Iterate over particle emitters
+    em.view<sParticleEmitterComponent, sRenderComponent>().each([&](Entity *entity, sParticleEmitterComponent* emitterComp, sRenderComponent* render) {
+        // The emitter has been removed at the end of its life
         if (_emitters.find(entity->handle) == _emitters.end())
-            initEmitter(entity);
+            return;
 
-        updateEmitter(em, entity, elapsedTime);
-        ++activeEmitters;
+        updateEmitter(em, entity, emitterComp, render, elapsedTime);
     });
+}
 
-    // 1 or more emitters have been deleted
-    // Update the emitter map
-    if (activeEmitters != _emitters.size())
+// The emitters are created and removed when the entity enters or leaves the system and not during the update,
+// because allocating the emitter buffer needs the opengl context and the update can run on a worker thread
+bool    ParticleSystem::onEntityNewComponent(Entity* entity, sComponent* component)
+{
+    if (!System::onEntityNewComponent(entity, component))
     {
-        auto it = _emitters.cbegin();
-        while (it != _emitters.cend())
-        {
-            Entity* entity = em.getEntity(it->first);
-            // The emitter has been deleted or the component has been removed, remove it from the map
-            if (!entity ||
-                !entity->getComponent<sParticleEmitterComponent>())
-            {
-                const Entity::sHandle& emitterHandler = it->first;
-                ++it;
-                removeEmitter(emitterHandler);
-            }
-            else
-                ++it;
-        }
+        return (false);
+    }
+
+    if (_emitters.find(entity->handle) == _emitters.end())
+    {
+        initEmitter(entity);
     }
+    return (true);
+}
+
+bool    ParticleSystem::onEntityRemovedComponent(Entity* entity, sComponent* component)
+{
+    if (!System::onEntityRemovedComponent(entity, component))
+    {
+        return (false);
+    }
+
+    removeEmitter(entity->handle);
+    return (true);
+}
+
+bool    ParticleSystem::onEntityDeleted(Entity* entity)
+{
+    if (!System::onEntityDeleted(entity))
+    {
+        return (false);
+    }
+
+    removeEmitter(entity->handle);
+    return (true);
 }
 
 std::unordered_map<Entity::sHandle, sEmitter*>* ParticleSystem::getEmitters()
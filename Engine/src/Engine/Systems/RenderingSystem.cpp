@@ -16,6 +16,7 @@
 #include <Engine/Core/Components/SphereColliderComponent.hh>
 #include <Engine/Core/Components/TextComponent.hh>
 #include <Engine/Core/Components/UiComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/LevelEntitiesDebugWindow.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Graphics/Geometries/Trapeze.hpp>
@@ -23,6 +24,7 @@
 #include <Engine/Graphics/UI/Font.hpp>
 #include <Engine/Utils/Exception.hpp>
 #include <Engine/Window/GameWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/RenderingSystem.hpp>
 
@@ -35,6 +37,8 @@ RenderingSystem::RenderingSystem(std::unordered_map<Entity::sHandle, sEmitter*>*
                                 _particleEmitters(particleEmitters)
 {
     addDependency<sRenderComponent>();
+    // Opengl calls have to be done on the main thread
+    setExclusive(true);
 
     if (!_bufferPool)
     {
@@ -63,6 +67,11 @@ void    RenderingSystem::attachCamera(Camera* camera)
     _camera = camera;
 }
 
+void    RenderingSystem::setInterpolation(float interpolation)
+{
+    _interpolation = interpolation;
+}
+
 void    RenderingSystem::addCollidersToRenderQueue(Entity* entity, sTransformComponent* transform)
 {
     if (!entity)
@@ -324,6 +333,9 @@ void    RenderingSystem::addCameraViewToRenderQueue(sCameraComponent* cameraComp
 
 void    RenderingSystem::update(EntityManager& em, float elapsedTime)
 {
+    PROFILE_ZONE("RenderingSystem::update");
+    ALLOCATION_SCOPE("RenderingSystem");
+
    _renderQueue.clear();
 
     for (auto& batch: _batches)
@@ -331,6 +343,11 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
         batch.buffer->free();
     }
     _batches.clear();
+
+    // Components changed since the previous update have a version greater than changedSince
+    uint32_t changedSince = _lastVersion;
+    _lastVersion = em.nextVersion();
+
     auto &&keyboard = GameWindow::getInstance()->getKeyboard();
 
     #if defined(ENGINE_DEBUG)
@@ -338,14 +355,12 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
         _displayAllColliders = !_displayAllColliders;
     #endif
 
-    forEachEntity(em, [&](Entity *entity) {
+    em.view<sRenderComponent, sTransformComponent>().each([&](Entity *entity, sRenderComponent* render, sTransformComponent* transform) {
         sParticleEmitterComponent* particleEmitterComp = entity->getComponent<sParticleEmitterComponent>();
         // Display the sRenderComponent only if there is no sParticleEmitterComponent
         // Or if the user want to render both sRenderComponent and sParticleEmitterComponent
         if (!particleEmitterComp || !particleEmitterComp->displayOnlyParticles)
         {
-            sRenderComponent *render = entity->getComponent<sRenderComponent>();
-            sTransformComponent* transform = entity->getComponent<sTransformComponent>();
             auto&& model = render->getModelInstance();
 
             if (model && render->display)
@@ -362,12 +377,12 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
 
                 if (uiComponent)
                 {
-                    BufferPool::SubBuffer* buffer = getModelBuffer(transform, render);
+                    BufferPool::SubBuffer* buffer = getModelBuffer(transform, render, changedSince);
                     _renderQueue.addUIModel(model, buffer->ubo, uiComponent->layer, buffer->offset, buffer->size);
                 }
                 else
                 {
-                    addBatch(transform, render);
+                    addBatch(getInterpolatedTransform(entity, transform), render);
                 }
 
                 if (textComponent)
@@ -382,14 +397,18 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
         }
     });
 
-    addParticlesToRenderQueue(em, elapsedTime);
+    {
+        PROFILE_ZONE("RenderingSystem::addParticlesToRenderQueue");
+        addParticlesToRenderQueue(em, elapsedTime);
+    }
 
     // Add lights to render queue
     {
-        auto& lights = em.getEntitiesByComponent<sLightComponent>();
-        for (Entity* light : lights)
+        ComponentPool* lights = em.getComponentPool<sLightComponent>();
+        for (uint32_t i = 0; i < lights->getSize(); ++i)
         {
-            sLightComponent* lightComp = light->getComponent<sLightComponent>();
+            Entity* light = lights->getEntities()[i];
+            sLightComponent* lightComp = static_cast<sLightComponent*>(lights->getComponents()[i]);
             sTransformComponent* transform = light->getComponent<sTransformComponent>();
 
             // Only display light cone in debug mode
@@ -419,21 +438,19 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
 
     // Add cameras views to render queue
     {
+        PROFILE_ZONE("RenderingSystem::render");
         auto& cameras = em.getEntitiesByComponent<sCameraComponent>();
 
+        // Update the transform of the cameras which moved or have been added
+        em.view<sCameraComponent, sTransformComponent>().eachChangedSince(changedSince, [](Entity* camera, sCameraComponent* cameraComp, sTransformComponent* transform) {
+            cameraComp->camera.setRotation(transform->getRotation());
+            cameraComp->camera.setPos(transform->getPos());
+        });
+
         for (auto& camera: cameras)
         {
-            sTransformComponent* transform = camera->getComponent<sTransformComponent>();
             sCameraComponent* cameraComp = camera->getComponent<sCameraComponent>();
 
-            // Update camera transform
-            if (transform->isDirty())
-            {
-                transform->isDirty(false);
-                cameraComp->camera.setRotation(transform->getRotation());
-                cameraComp->camera.setPos(transform->getPos());
-            }
-
             if (!_camera)
             {
                 Renderer::getInstance()->render(&cameraComp->camera, _renderQueue);
@@ -465,7 +482,7 @@ void    RenderingSystem::update(EntityManager& em, float elapsedTime)
     }
 }
 
-void    RenderingSystem::addBatch(sTransformComponent* transform, sRenderComponent* render)
+void    RenderingSystem::addBatch(const glm::mat4& transform, sRenderComponent* render)
 {
     auto&& model = render->getModelInstance();
     auto& meshsInstances = model->getMeshsInstances();
@@ -500,20 +517,39 @@ void    RenderingSystem::addBatch(sTransformComponent* transform, sRenderCompone
             batch->hideDynamic = hideDynamic;
         }
         uint32_t offset = batch->instances * (sizeof(glm::vec4) + sizeof(glm::mat4));
-        auto transform_ = transform->getTransform();
-        batch->buffer->ubo->update((void*)&transform_, sizeof(glm::mat4), offset);
+        batch->buffer->ubo->update((void*)&transform, sizeof(glm::mat4), offset);
         batch->buffer->ubo->update((void*)&render->color, sizeof(glm::vec4), offset + sizeof(glm::mat4));
         batch->instances++;
     }
 }
 
-BufferPool::SubBuffer*  RenderingSystem::getModelBuffer(sTransformComponent* transform,sRenderComponent* render)
+glm::mat4   RenderingSystem::getInterpolatedTransform(Entity* entity, sTransformComponent* transform) const
+{
+    sRigidBodyComponent* rigidBody = entity->getComponent<sRigidBodyComponent>();
+
+    // Don't interpolate the bodies moved since the last fixed update (teleported by a script...)
+    if (!rigidBody || !rigidBody->interpolated || !rigidBody->isEnabled() ||
+        transform->getPos() != rigidBody->simulatedPos)
+    {
+        return (transform->getTransform());
+    }
+
+    // The translation is the last column of the transform
+    glm::mat4 interpolatedTransform = transform->getTransform();
+    interpolatedTransform[3] = glm::vec4(glm::mix(rigidBody->previousPos, rigidBody->simulatedPos, _interpolation), 1.0f);
+
+    return (interpolatedTransform);
+}
+
+BufferPool::SubBuffer*  RenderingSystem::getModelBuffer(sTransformComponent* transform, sRenderComponent* render, uint32_t changedSince)
 {
+    // The buffer is allocated by the first call
+    bool newBuffer = render->getModelInstance()->getBuffer() == nullptr;
     BufferPool::SubBuffer* buffer = render->getModelInstance()->getBuffer(_bufferPool.get());
 
-    if (transform->isDirty() || render->lastColor != render->color)
+    // The color is compared because animations modify it without stamping the component
+    if (newBuffer || transform->hasChangedSince(changedSince) || render->lastColor != render->color)
     {
-        transform->isDirty(false);
         render->lastColor = render->color;
         updateModelBuffer(buffer, transform->getTransform(), render->color);
     }
@@ -4,6 +4,8 @@
 
 #include <Engine/Core/Components/ScriptComponent.hh>
 #include <Engine/Core/Components/TransformComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/RigidBodySystem.hpp>
 
@@ -11,18 +13,33 @@ RigidBodySystem::RigidBodySystem()
 {
     this->addDependency<sRigidBodyComponent>();
     this->addDependency<sTransformComponent>();
+
+    // Call the scripts collisions callbacks
+    this->setExclusive(true);
+    this->setFixedUpdate(true);
 }
 
 void RigidBodySystem::update(EntityManager &em, float elapsedTime)
 {
-    this->forEachEntity(em, [&](Entity* entity) {
-        sRigidBodyComponent* rigidBody = entity->getComponent<sRigidBodyComponent>();
-        sTransformComponent* transform = entity->getComponent<sTransformComponent>();
+    PROFILE_ZONE("RigidBodySystem::update");
+    ALLOCATION_SCOPE("RigidBodySystem");
 
+    // The scripts collisions callbacks can access any entity, call them before the integration
+    em.view<sRigidBodyComponent, sTransformComponent>().each([&](Entity* entity, sRigidBodyComponent* rigidBody, sTransformComponent* transform) {
         handleCollisions(em, entity, rigidBody);
+    });
 
+    // Each body is integrated independently
+    parallelForEach(em, [&](Entity* entity) {
+        sRigidBodyComponent* rigidBody = entity->getComponent<sRigidBodyComponent>();
+        sTransformComponent* transform = entity->getComponent<sTransformComponent>();
+
+        // Keep the position before the step for the rendering interpolation
+        // The position after the step is saved by the GameState, once the collisions are resolved
+        rigidBody->previousPos = transform->getPos();
         rigidBody->velocity += rigidBody->gravity * elapsedTime;
         transform->translate(rigidBody->velocity * elapsedTime);
+        rigidBody->interpolated = true;
     });
 }
 
@@ -30,15 +47,9 @@ void RigidBodySystem::handleCollisions(EntityManager &em, Entity* entity, sRigid
 {
     sScriptComponent* scriptComponent = entity->getComponent<sScriptComponent>();
 
+    // The collisions with destroyed entities are removed by the CollisionSystem observers
     for (auto it = rigidBody->collisions.begin(); it != rigidBody->collisions.end(); ++it)
     {
-        // The entity has been deleted, remove collision
-        if (!em.getEntity(it->first))
-        {
-            rigidBody->collisions[it->first] = eCollisionState::NO_COLLISION;
-            continue;
-        }
-
         if (it->second == eCollisionState::ENTERING_COLLISION)
         {
             if (scriptComponent != nullptr)
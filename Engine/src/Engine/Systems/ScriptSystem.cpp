@@ -8,23 +8,29 @@
 #include <Engine/Core/Components/ScriptComponent.hh>
 #include <Engine/Core/ScriptFactory.hpp>
 #include <Engine/EntityFactory.hpp>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Debug.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/ScriptSystem.hpp>
 
 ScriptSystem::ScriptSystem()
 {
     this->addDependency<sScriptComponent>();
+
+    // Scripts can access anything
+    this->setExclusive(true);
 }
 
 ScriptSystem::~ScriptSystem() {}
 
 void    ScriptSystem::update(EntityManager &em, float elapsedTime)
 {
-    forEachEntity(em, [&](Entity *entity)
-    {
-        sScriptComponent* scriptComponent = entity->getComponent<sScriptComponent>();
+    PROFILE_ZONE("ScriptSystem::update");
+    ALLOCATION_SCOPE("ScriptSystem");
 
+    em.view<sScriptComponent>().each([&](Entity *entity, sScriptComponent* scriptComponent)
+    {
         for (auto&& script : scriptComponent->scripts)
         {
             if (!script->getEntity())
@@ -32,6 +38,7 @@ void    ScriptSystem::update(EntityManager &em, float elapsedTime)
 
             // We can't initialize the scripts in ScriptSystem::initializeScript
             // because the entity components used in BaseScript::Start may not be added
+            PROFILE_ZONE_DYNAMIC(script->getName());
             if (!script->isInitialized)
             {
                 script->start();
@@ -8,26 +8,33 @@
 #include <Engine/Core/Components/RenderComponent.hh>
 #include <Engine/Core/Components/TransformComponent.hh>
 #include <Engine/Core/Components/UiComponent.hh>
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Window/GameWindow.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Engine/Systems/UISystem.hpp>
 
 UISystem::UISystem()
 {
-    addDependency<sRenderComponent>();
+    addDependency<sRenderComponent>(eAccess::READ);
     addDependency<sUiComponent>();
     addDependency<sTransformComponent>();
+    addAccess<sTextComponent>(eAccess::WRITE);
+    setAccessOwnEntitiesOnly(true);
+    // The render component model is loaded the first time it's used
+    setMainThreadOnly(true);
 }
 
 UISystem::~UISystem() {}
 
 void    UISystem::update(EntityManager& em, float elapsedTime)
 {
-    forEachEntity(em, [&](Entity *entity) {
-        handleAlignment(em, entity);
-    });
+    PROFILE_ZONE("UISystem::update");
+    ALLOCATION_SCOPE("UISystem");
+
+    alignEntities(em, false);
 }
 
 bool    UISystem::init()
@@ -38,21 +45,24 @@ bool    UISystem::init()
 
 void    UISystem::onWindowResize(EntityManager &em)
 {
-    forEachEntity(em, [&](Entity *entity) {
-        handleAlignment(em, entity, true);
+    alignEntities(em, true);
+}
+
+void    UISystem::alignEntities(EntityManager& em, bool forceUpdate)
+{
+    // Not split with WorkerPool::parallelFor: the system is main thread only (the models are loaded with opengl)
+    // and the UI entities are few
+    em.view<sUiComponent, sRenderComponent, sTransformComponent>().each([&](Entity *entity, sUiComponent* ui, sRenderComponent* render, sTransformComponent* transform) {
+        handleAlignment(entity, ui, render, transform, forceUpdate);
     });
 }
 
-void    UISystem::handleAlignment(EntityManager& em, Entity* entity, bool forceUpdate)
+void    UISystem::handleAlignment(Entity* entity, sUiComponent* ui, sRenderComponent* render, sTransformComponent* transform, bool forceUpdate)
 {
-    sUiComponent* ui = entity->getComponent<sUiComponent>();
     sTextComponent* textComp = entity->getComponent<sTextComponent>();
 
-    if (ui && (ui->needUpdate || forceUpdate))
+    if (ui->needUpdate || forceUpdate)
     {
-        sRenderComponent* render = entity->getComponent<sRenderComponent>();
-        sTransformComponent* transform = entity->getComponent<sTransformComponent>();
-
         glm::vec3 size = render->getModel()->getSize();
         float windowWidth = (float) GameWindow::getInstance()->getBufferWidth();
         float windowHeight = (float) GameWindow::getInstance()->getBufferHeight();
@@ -128,9 +138,6 @@ void    UISystem::handleAlignment(EntityManager& em, Entity* entity, bool forceU
     }
     else if (textComp && textComp->text.isDirty())
     {
-        sRenderComponent* render = entity->getComponent<sRenderComponent>();
-        sTransformComponent* transform = entity->getComponent<sTransformComponent>();
-
         glm::vec3 size = render->getModel()->getSize();
         size *= transform->getScale();
 
@@ -2,18 +2,14 @@
 * @Author   Guillaume Labey
 */
 
-#include <cstdlib>
-#include <ctime>
 #include <algorithm>
 
 #include <Engine/Debug/Debug.hpp>
+#include <Engine/Utils/Maths.hpp>
 
 #include <Engine/Utils/Helper.hpp>
 
-Helper::Helper()
-{
-    std::srand(static_cast<unsigned int>(std::time(0)));
-}
+Helper::Helper() {}
 
 Helper::~Helper() {}
 
@@ -25,7 +21,8 @@ float   Helper::randFloat(float from, float to)
     if (max - min == 0)
         return (0.0f);
 
-    return (min + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (max - min))));
+    // Use the seeded random engine so the sessions can be replayed
+    return (Maths::randomFrom(min, max));
 }
 
 int Helper::randInt(int from, int to)
@@ -36,7 +33,7 @@ int Helper::randInt(int from, int to)
     if (max - min == 0)
         return (0);
 
-    return (min + (rand() / (RAND_MAX / (max - min))));
+    return (Maths::randomFrom(min, max));
 }
 
 void    Helper::copyAssimpMat(const aiMatrix4x4& from, glm::mat4& to)
@@ -7,6 +7,7 @@
 #include <Engine/BasicState.hpp>
 #include <Engine/Core/Components/NameComponent.hh>
 #include <Engine/Debug/Logger.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Utils/Exception.hpp>
 #include <Engine/Utils/JsonReader.hpp>
@@ -109,6 +110,7 @@ void    LevelLoader::save(const std::string& levelName, const std::vector<Entity
 
 void    LevelLoader::load(const std::string& levelName, EntityManager* em)
 {
+    PROFILE_ZONE("LevelLoader::load");
     JsonReader jsonReader;
     JsonValue parsed;
 
@@ -3,3 +3,24 @@
 */
 
 #include <Engine/Utils/Maths.hpp>
+
+static uint32_t     generateSeed()
+{
+    std::random_device rdev;
+
+    return (rdev());
+}
+
+uint32_t                    Maths::_randomSeed = generateSeed();
+std::default_random_engine  Maths::_randomEngine(Maths::_randomSeed);
+
+void    Maths::setRandomSeed(uint32_t seed)
+{
+    _randomSeed = seed;
+    _randomEngine.seed(seed);
+}
+
+uint32_t    Maths::getRandomSeed()
+{
+    return (_randomSeed);
+}
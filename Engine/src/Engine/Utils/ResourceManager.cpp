@@ -2,7 +2,9 @@
 * @Author   Guillaume Labey
 */
 
+#include <Engine/Debug/AllocationTracker.hpp>
 #include <Engine/Debug/Logger.hpp>
+#include <Engine/Debug/Profiler.hpp>
 #include <fstream>
 #include <algorithm>
 #include <vector>
@@ -34,8 +36,30 @@ ResourceManager::ResourceManager()
 
 ResourceManager::~ResourceManager() {}
 
+static const char*  getResourceTypeName(Resource::eType type)
+{
+    switch (type)
+    {
+        case Resource::eType::MODEL:
+            return ("Resource: Model");
+        case Resource::eType::MATERIAL:
+            return ("Resource: Material");
+        case Resource::eType::GEOMETRY:
+            return ("Resource: Geometry");
+        case Resource::eType::FILE:
+            return ("Resource: File");
+        case Resource::eType::TEXTURE:
+            return ("Resource: Texture");
+        case Resource::eType::FONT:
+            return ("Resource: Font");
+    }
+
+    return ("Resource: Unknown");
+}
+
 void    ResourceManager::loadResources(const std::string& directory)
 {
+    PROFILE_ZONE("ResourceManager::loadResources");
     DIR* dir;
     struct dirent* ent;
     ResourceManager* ResourceManager = ResourceManager::getInstance();
@@ -207,6 +231,8 @@ T*  ResourceManager::getOrLoadResource(const std::string& path)
 template<typename T>
 T*  ResourceManager::loadResource(const std::string& path)
 {
+    // The peak live bytes of the tag is the memory high-water mark of the resource type
+    ALLOCATION_SCOPE(getResourceTypeName(T::getResourceType()));
     std::string name = getBasename(path);
     std::unique_ptr<T> resource = std::make_unique<T>();
 
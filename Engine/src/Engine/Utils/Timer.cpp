@@ -2,8 +2,6 @@
 * @Author   Guillaume Labey
 */
 
-#include <GLFW/glfw3.h>
-
 #include <Engine/Utils/Timer.hpp>
 
 Timer::Timer()
@@ -15,10 +13,12 @@ Timer::~Timer() {}
 
 void    Timer::reset()
 {
-    _lastReset = (float)glfwGetTime();
+    _lastReset = std::chrono::steady_clock::now();
 }
 
 float   Timer::getElapsedTime() const
 {
-    return ((float)glfwGetTime() - _lastReset);
+    std::chrono::duration<float> elapsedTime = std::chrono::steady_clock::now() - _lastReset;
+
+    return (elapsedTime.count());
 }
@@ -7,6 +7,7 @@
 #include <imgui.h>
 #include <imgui_impl_glfw_gl3.h>
 
+#include <Engine/Core/Headless.hpp>
 #include <Engine/Graphics/Renderer.hpp>
 #include <Engine/Sound/SoundManager.hpp>
 #include <Engine/Debug/Debug.hpp>
@@ -34,6 +35,16 @@ bool    GameWindow::initialize()
     const GLFWvidmode*  vidmode = nullptr;
     int width = 0, height = 0;
 
+    // No GLFW window, the window only keeps its size and the running state
+    if (Headless::isEnabled())
+    {
+        _screenWidth = _bufferWidth = HEADLESS_WINDOW_WIDTH;
+        _screenHeight = _bufferHeight = HEADLESS_WINDOW_HEIGHT;
+        _fullscreen = false;
+        this->setRunning(true);
+        return (true);
+    }
+
     // Initializing GLFW.
     if (glfwInit() == GLFW_FALSE)
     {
@@ -236,6 +247,9 @@ bool            GameWindow::isFullscreen() const
 {
     GLFWmonitor*    monitor = nullptr;
 
+    if (!_window)
+        return (false);
+
     monitor = glfwGetWindowMonitor(_window);
     return (monitor != nullptr);
 }
@@ -257,6 +271,9 @@ Mouse&      GameWindow::getMouse()
 
 void    GameWindow::maximize()
 {
+    if (!_window)
+        return;
+
     glfwMaximizeWindow(_window);
 }
 
@@ -266,6 +283,9 @@ void    GameWindow::toggleFullscreen()
     GLFWmonitor*        monitor = nullptr;
     int                 refreshRate = 0;
 
+    if (!_window)
+        return;
+
     monitor = glfwGetWindowMonitor(_window);
     if (monitor != nullptr)
     {
@@ -304,6 +324,9 @@ void    GameWindow::setInstance(std::shared_ptr<GameWindow> instance)
 
 bool    GameWindow::isCursorVisible() const
 {
+    if (!_window)
+        return (false);
+
     return (glfwGetInputMode(_window, GLFW_CURSOR) == GLFW_CURSOR_NORMAL);
 }
 
@@ -311,18 +334,27 @@ void        GameWindow::setCursorVisible(bool visible)
 {
     int     visibleValue;
 
+    if (!_window)
+        return;
+
     visibleValue = visible ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_HIDDEN;
     glfwSetInputMode(_window, GLFW_CURSOR, visibleValue);
 }
 
 bool    GameWindow::isRunning() const
 {
-    //return (_running);
+    // Headless mode
+    if (!_window)
+        return (_running);
+
     return (glfwWindowShouldClose(_window) == GLFW_FALSE);
 }
 
 void    GameWindow::display()
 {
+    if (!_window)
+        return;
+
     glfwSwapBuffers(_window);
 }
 
@@ -331,11 +363,19 @@ void    GameWindow::pollEvents()
     _keyboard.updateKeyboardState();
     _keyboard.resetTypedText();
     _mouse.updateMouseState();
-    glfwPollEvents();
+
+    if (_window)
+        glfwPollEvents();
 }
 
 void    GameWindow::close()
 {
+    if (!_window)
+    {
+        setRunning(false);
+        return;
+    }
+
     //glfwSetWindowShouldClose(_window, 0);
     ImGui_ImplGlfwGL3_Shutdown();
     glfwDestroyWindow(_window);
@@ -344,6 +384,12 @@ void    GameWindow::close()
 
 void    GameWindow::shutdown()
 {
+    if (!_window)
+    {
+        setRunning(false);
+        return;
+    }
+
     ImGui_ImplGlfwGL3_Shutdown();
     glfwDestroyWindow(_window);
     glfwTerminate();
@@ -635,6 +681,14 @@ void    GameWindow::hasLostFocus(bool lostFocus)
     _lostFocus = lostFocus;
 }
 
+bool    GameWindow::isMinimized() const
+{
+    if (!_window)
+        return (false);
+
+    return (glfwGetWindowAttrib(_window, GLFW_ICONIFIED) == GLFW_TRUE);
+}
+
 Timer&  GameWindow::getTimer()
 {
     return (_timer);
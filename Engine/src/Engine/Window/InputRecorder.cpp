@@ -0,0 +1,285 @@
+/**
+* @Author   Guillaume Labey
+*/
+
+#include <random>
+
+#include <Engine/Debug/Logger.hpp>
+#include <Engine/Window/GameWindow.hpp>
+
+#include <Engine/Window/InputRecorder.hpp>
+
+#define FRAME_FLAG_LOST_FOCUS       (1 << 0)
+#define FRAME_FLAG_CURSOR_ENTERED   (1 << 1)
+
+InputRecorder::InputRecorder(): _mode(eMode::NONE), _seed(0), _framesNb(0), _readPos(0) {}
+
+InputRecorder::~InputRecorder()
+{
+    stop();
+}
+
+bool    InputRecorder::startRecording(const std::string& fileName)
+{
+    stop();
+
+    _file.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!_file.good())
+    {
+        LOG_ERROR("InputRecorder::startRecording: Can't open \"%s\"", fileName.c_str());
+        return (false);
+    }
+
+    std::random_device rdev;
+    _seed = rdev();
+
+    auto window = GameWindow::getInstance();
+    write<uint32_t>(INPUT_RECORD_MAGIC);
+    write<uint16_t>(INPUT_RECORD_VERSION);
+    write<uint32_t>(_seed);
+    write<int32_t>(window ? window->getBufferWidth() : 0);
+    write<int32_t>(window ? window->getBufferHeight() : 0);
+
+    _mode = eMode::RECORD;
+    _framesNb = 0;
+    LOG_INFO("Recording the input in \"%s\" (seed %u)", fileName.c_str(), _seed);
+    return (true);
+}
+
+bool    InputRecorder::startReplay(const std::string& fileName)
+{
+    stop();
+
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file.good())
+    {
+        LOG_ERROR("InputRecorder::startReplay: Can't open \"%s\"", fileName.c_str());
+        return (false);
+    }
+
+    _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    _readPos = 0;
+
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    int32_t bufferWidth = 0;
+    int32_t bufferHeight = 0;
+    if (!read(magic) || !read(version) || !read(_seed) || !read(bufferWidth) || !read(bufferHeight) ||
+        magic != INPUT_RECORD_MAGIC || version != INPUT_RECORD_VERSION)
+    {
+        LOG_ERROR("InputRecorder::startReplay: \"%s\" is not a valid input record", fileName.c_str());
+        _data.clear();
+        return (false);
+    }
+
+    // The UI layout and the cursor positions depend on the window size
+    auto window = GameWindow::getInstance();
+    if (window && (window->getBufferWidth() != bufferWidth || window->getBufferHeight() != bufferHeight))
+    {
+        LOG_WARN("InputRecorder::startReplay: The input was recorded with a %dx%d window, the replay can differ",
+                bufferWidth, bufferHeight);
+    }
+
+    _mode = eMode::REPLAY;
+    _framesNb = 0;
+    LOG_INFO("Replaying the input of \"%s\" (seed %u)", fileName.c_str(), _seed);
+    return (true);
+}
+
+void    InputRecorder::stop()
+{
+    if (_mode == eMode::RECORD)
+    {
+        _file.close();
+        LOG_INFO("InputRecorder: %u frames recorded", _framesNb);
+    }
+    else if (_mode == eMode::REPLAY)
+    {
+        LOG_INFO("InputRecorder: %u frames replayed", _framesNb);
+    }
+
+    _data.clear();
+    _readPos = 0;
+    _mode = eMode::NONE;
+}
+
+InputRecorder::eMode    InputRecorder::getMode() const
+{
+    return (_mode);
+}
+
+uint32_t    InputRecorder::getSeed() const
+{
+    return (_seed);
+}
+
+uint32_t    InputRecorder::getFramesNb() const
+{
+    return (_framesNb);
+}
+
+bool    InputRecorder::updateFrame(GameWindow& window, float& elapsedTime)
+{
+    if (_mode == eMode::RECORD)
+    {
+        recordFrame(window, elapsedTime);
+    }
+    else if (_mode == eMode::REPLAY && !replayFrame(window, elapsedTime))
+    {
+        stop();
+        return (false);
+    }
+
+    return (true);
+}
+
+void    InputRecorder::recordFrame(GameWindow& window, float elapsedTime)
+{
+    Keyboard& keyboard = window.getKeyboard();
+    Mouse& mouse = window.getMouse();
+    Cursor& cursor = mouse.getCursor();
+    uint8_t flags = 0;
+
+    flags |= window.hasLostFocus() ? FRAME_FLAG_LOST_FOCUS : 0;
+    flags |= cursor.isInTheWindow() ? FRAME_FLAG_CURSOR_ENTERED : 0;
+
+    write(elapsedTime);
+    write(flags);
+    write(cursor.getX());
+    write(cursor.getY());
+    write(mouse.getScroll().xOffset);
+    write(mouse.getScroll().yOffset);
+
+    // Only the keys and the buttons which are not idle
+    {
+        uint8_t keysNb = 0;
+        for (const auto& key: keyboard.getStateMap())
+        {
+            keysNb += key.second != Keyboard::eKeyState::KEY_IDLE;
+        }
+
+        write(keysNb);
+        for (const auto& key: keyboard.getStateMap())
+        {
+            if (key.second != Keyboard::eKeyState::KEY_IDLE)
+            {
+                write((int8_t)key.first);
+                write((int8_t)key.second);
+            }
+        }
+    }
+
+    {
+        uint8_t buttonsNb = 0;
+        for (const auto& button: mouse.getStateMap())
+        {
+            buttonsNb += button.second != Mouse::eButtonState::CLICK_IDLE;
+        }
+
+        write(buttonsNb);
+        for (const auto& button: mouse.getStateMap())
+        {
+            if (button.second != Mouse::eButtonState::CLICK_IDLE)
+            {
+                write((int8_t)button.first);
+                write((int8_t)button.second);
+            }
+        }
+    }
+
+    const std::string& typedText = keyboard.getTypedText();
+    write((uint16_t)typedText.size());
+    _file.write(typedText.data(), typedText.size());
+
+    _framesNb++;
+}
+
+bool    InputRecorder::replayFrame(GameWindow& window, float& elapsedTime)
+{
+    // End of the record
+    if (_readPos == _data.size())
+    {
+        return (false);
+    }
+
+    if (!readFrame(window, elapsedTime))
+    {
+        LOG_ERROR("InputRecorder::replayFrame: Truncated record at frame %u", _framesNb);
+        return (false);
+    }
+
+    _framesNb++;
+    return (true);
+}
+
+bool    InputRecorder::readFrame(GameWindow& window, float& elapsedTime)
+{
+    Keyboard& keyboard = window.getKeyboard();
+    Mouse& mouse = window.getMouse();
+    Cursor& cursor = mouse.getCursor();
+    uint8_t flags = 0;
+    double cursorX = 0;
+    double cursorY = 0;
+    sScroll scroll{0.0, 0.0};
+
+    if (!read(elapsedTime) || !read(flags) || !read(cursorX) || !read(cursorY) ||
+        !read(scroll.xOffset) || !read(scroll.yOffset))
+    {
+        return (false);
+    }
+
+    window.hasLostFocus((flags & FRAME_FLAG_LOST_FOCUS) != 0);
+    cursor.setWindowEntering((flags & FRAME_FLAG_CURSOR_ENTERED) != 0);
+    cursor.setXPosition(cursorX);
+    cursor.setYPosition(cursorY);
+    mouse.getScroll() = scroll;
+
+    // The live input is discarded
+    keyboard.resetKeyboardState();
+    for (auto& button: mouse.getStateMap())
+    {
+        button.second = Mouse::eButtonState::CLICK_IDLE;
+    }
+
+    uint8_t keysNb = 0;
+    if (!read(keysNb))
+    {
+        return (false);
+    }
+    for (uint8_t i = 0; i < keysNb; ++i)
+    {
+        int8_t key = 0;
+        int8_t state = 0;
+        if (!read(key) || !read(state))
+        {
+            return (false);
+        }
+        keyboard.getStateMap()[(Keyboard::eKey)key] = (Keyboard::eKeyState)state;
+    }
+
+    uint8_t buttonsNb = 0;
+    if (!read(buttonsNb))
+    {
+        return (false);
+    }
+    for (uint8_t i = 0; i < buttonsNb; ++i)
+    {
+        int8_t button = 0;
+        int8_t state = 0;
+        if (!read(button) || !read(state))
+        {
+            return (false);
+        }
+        mouse.getStateMap()[(Mouse::eButton)button] = (Mouse::eButtonState)state;
+    }
+
+    uint16_t typedTextSize = 0;
+    if (!read(typedTextSize) || _readPos + typedTextSize > _data.size())
+    {
+        return (false);
+    }
+    keyboard._typedText.assign(_data.data() + _readPos, typedTextSize);
+    _readPos += typedTextSize;
+
+    return (true);
+}
@@ -45,4 +45,6 @@ private:
     sRenderComponent*       _healthRender;
 
     tEventSound* _hitCastle = nullptr;
+
+    uint32_t                _enemyTag;
 };
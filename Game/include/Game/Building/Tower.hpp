@@ -29,6 +29,9 @@ private:
     float       _range;
     int         _damage;
 
+    uint32_t    _enemyTag;
+    EntityFactory::sBlueprintHandle _fireballBlueprint;
+
     tEventSound* _towershootSound = nullptr;
 
     sTransformComponent* _towerTransform;
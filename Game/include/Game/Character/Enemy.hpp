@@ -69,4 +69,10 @@ private:
     int     _experienceEarned = 0;
 
     std::vector<glm::vec4> _baseBlooms;
+
+    uint32_t _enemyTag;
+    uint32_t _castleExplosionTag;
+    uint32_t _projectileKnockBackTag;
+
+    EntityFactory::sBlueprintHandle _explosionBlueprint;
 };
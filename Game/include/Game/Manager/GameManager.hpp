@@ -40,4 +40,6 @@ public:
 
 private:
     std::string _mapName;
+
+    uint32_t    _projectileTag;
 };
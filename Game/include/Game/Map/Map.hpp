@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <glm/vec2.hpp>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +42,8 @@ public:
 
 private:
     void                    init();
+    // Create the entities of the cells with the same archetype
+    void                    initCells(const std::string& typeName, const std::vector<glm::ivec2>& cells);
 
 private:
     DoubleArray<char>   _spawnersPaths;
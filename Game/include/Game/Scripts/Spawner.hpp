@@ -34,8 +34,8 @@ public:
 
         std::vector<Entity::sHandle>   spawnedEntities;
 
-        //  Remove dead entities from sEntity::spawnedEntities
-        void    updateSpawnedEntities();
+        //  Remove a dead entity from sEntity::spawnedEntities
+        void    onSpawnedEntityDestroyed(const Entity::sHandle& entityHandle);
 
         bool    areAllEntitiesSpawned();
         bool    areAllSpawnedEntitiesDead();
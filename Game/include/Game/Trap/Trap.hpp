@@ -9,7 +9,7 @@
 class Trap : public BaseScript
 {
 public:
-    Trap() = default;
+    Trap();
     ~Trap() = default;
 
     virtual void start() = 0;
@@ -20,4 +20,7 @@ public:
 protected:
     int damage;
     int usage{5};
+
+private:
+    uint32_t _enemyTag;
 };
@@ -47,4 +47,6 @@ private:
     Entity* _laser = nullptr;
 
     tEventSound* _shootSound = nullptr;
+
+    uint32_t _enemyTag;
 };
@@ -25,15 +25,23 @@ public:
     void onCollisionEnter(Entity* entity) override final;
 
 private:
+    // The projectile is destroyed when the target is destroyed
+    void setTarget(Entity* target);
     void followTarget(Entity* target);
     void followDirection(const glm::vec3& dir);
     void destroyProjectile();
 
 private:
     Entity::sHandle _targetHandle;
+    Entity* _target;
+    uint32_t _targetObserver;
     float _speed;
     int _damage;
 
+    uint32_t _enemyTag;
+    uint32_t _tileWallTag;
+    uint32_t _tileBaseTurretTag;
+
     sTransformComponent* _projectileTransform;
     sSphereColliderComponent* _projectileCollider;
     sRigidBodyComponent* _projectileRigidBody;
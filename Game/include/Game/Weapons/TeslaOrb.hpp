@@ -32,4 +32,6 @@ private:
     Attribute*              _range;
 
     glm::vec3               _startPosition;
+
+    uint32_t                _tileBaseTurretTag;
 };
@@ -39,4 +39,6 @@ private:
 
 private:
     tEventSound* _shootSound = nullptr;
+
+    uint32_t    _enemyTag;
 };
@@ -18,6 +18,7 @@ void Castle::start()
     Health::init(_render);
     _hitCastle = EventSound::getEventByEventType(eEventSound::ENEMY_HIT_CASTLE);
     SoundManager::getInstance()->setSoundVolume(_hitCastle->soundID, 0.65f);
+    _enemyTag = EntityTags::getId(ENEMY_TAG);
 }
 
 void Castle::update(float dt)
@@ -27,7 +28,7 @@ void Castle::update(float dt)
 
 void Castle::onCollisionEnter(Entity* entity)
 {
-    if (entity->getTag() == ENEMY_TAG)
+    if (entity->hasTag(_enemyTag))
     {
         this->takeDamage(DEFAULT_CASTLE_DMG_FROM_ENEMY);
         this->_render->_animator.play("takeDamage", false);
@@ -7,6 +7,7 @@
 #include <Engine/Physics/Collisions.hpp>
 #include <Engine/Debug/Debug.hpp>
 
+#include <Game/Character/Enemy.hpp>
 #include <Game/Weapons/Projectile.hpp>
 #include <Game/Building/Tower.hpp>
 
@@ -22,6 +23,8 @@ void Tower::start()
     _range = 12.0f;
     _damage = 125;
     _towershootSound = EventSound::getEventByEventType(eEventSound::TOWER_SHOOT);
+    _enemyTag = EntityTags::getId(ENEMY_TAG);
+    _fireballBlueprint = EntityFactory::getBlueprint("FIRE_BALL");
 }
 
 void Tower::update(float dt)
@@ -89,13 +92,13 @@ void Tower::shootTarget(Entity* target)
     sScriptComponent*       fireballScripts;
     Projectile*             projectileScript;
 
-    fireball = Instantiate("FIRE_BALL");
+    fireball = Instantiate(_fireballBlueprint);
     fireballScripts = fireball->getComponent<sScriptComponent>();
     projectileScript = fireballScripts->getScript<Projectile>("Projectile");
 
     projectileScript->_projectileTransform->setPos(_towerTransform->getPos());
     projectileScript->_projectileTransform->translate(glm::vec3(0.0f, _towerRender->getModel()->getMax().y - 20.0f, 0.0f));
-    projectileScript->_targetHandle = target->handle;
+    projectileScript->setTarget(target);
     projectileScript->_damage = _damage;
     projectileScript->followTarget(target);
 
@@ -114,7 +117,7 @@ Entity* Tower::getClosestEnemy()
     Entity* closestEnemy = nullptr;
     float closestDistance = 0.0f;
     EntityManager* em = EntityFactory::getBindedEntityManager();
-    const auto& enemies = em->getEntitiesByTag("Enemy");
+    const auto& enemies = em->getEntitiesByTag(_enemyTag);
 
     for (auto &enemy : enemies)
     {
@@ -37,14 +37,20 @@ void Enemy::start()
     if (this->_rigidBody == nullptr)
         EXCEPT(NullptrException, "Could not retrieve %s from Entity with archetype \"%s\"", "sRigidBodyComponent", "ENEMY");
 
-    this->_rigidBody->ignoredTags.push_back("Enemy");
+    this->_rigidBody->ignoredTags.push_back(ENEMY_TAG);
+    this->_rigidBody->updateIgnoredTagsMask();
+
+    this->_enemyTag = EntityTags::getId(ENEMY_TAG);
+    this->_castleExplosionTag = EntityTags::getId("CastleExplosion");
+    this->_projectileKnockBackTag = EntityTags::getId("ProjectileKnockBack");
+    this->_explosionBlueprint = EntityFactory::getBlueprint("ENEMY_EXPLOSION");
 }
 
 void Enemy::update(float dt)
 {
     EntityManager* em = EntityFactory::getBindedEntityManager();
     // Game lost, can't move
-    if (em->getEntityByTag("CastleExplosion"))
+    if (em->getEntityByTag(this->_castleExplosionTag))
     {
         this->_rigidBody->velocity = {};
         return;
@@ -100,12 +106,12 @@ void    Enemy::onCollisionEnter(Entity* entity)
 {
     EntityManager* em = EntityFactory::getBindedEntityManager();
     // Game lost, no collision
-    if (em->getEntityByTag("CastleExplosion"))
+    if (em->getEntityByTag(this->_castleExplosionTag))
     {
         return;
     }
 
-    if (entity->getTag() == "ProjectileKnockBack")
+    if (entity->hasTag(this->_projectileKnockBackTag))
     {
         EntityManager* em = EntityFactory::getBindedEntityManager();
         const auto& player = em->getEntityByTag("Player");
@@ -117,7 +123,7 @@ void    Enemy::onCollisionEnter(Entity* entity)
         direction *= -15;
         _transform->translate(direction);
     }
-    else if (entity->getTag() != "Enemy" &&
+    else if (!entity->hasTag(this->_enemyTag) &&
         _path.size() > 0 &&
         _pathProgress < _path.size())
     {
@@ -147,7 +153,7 @@ void Enemy::death()
 
             sRenderComponent* renderSphereExplosion = sphereExplosion->getComponent<sRenderComponent>();
             renderSphereExplosion->_animator.play("growing_up", false);
-            auto enemies = em->getEntitiesByTag("Enemy");
+            auto enemies = em->getEntitiesByTag(this->_enemyTag);
 
             for (auto& enemy : enemies)
             {
@@ -197,7 +203,7 @@ void Enemy::death()
 // Called to remove the enemy when "dying", without gaining golds or exp ?
 void Enemy::remove()
 {
-    Entity* explosion = Instantiate("ENEMY_EXPLOSION");
+    Entity* explosion = Instantiate(this->_explosionBlueprint);
     sTransformComponent* explosionTransform = explosion->getComponent<sTransformComponent>();
     sTransformComponent* entityTransform = entity->getComponent<sTransformComponent>();
     explosionTransform->setPos(entityTransform->getPos());
@@ -254,7 +254,7 @@ void        NewBuild::triggerBuildableZone(const std::string &archetype)
             auto    tileTransform = floorTile->getComponent<sTransformComponent>();
             auto    tileScriptComponent = floorTile->getComponent<sScriptComponent>();
 
-            if (tileScriptComponent == nullptr || tileScriptComponent->enabled == false)
+            if (tileScriptComponent == nullptr || tileScriptComponent->isEnabled() == false)
                 continue;
 
             Tile*   tileScript = tileScriptComponent->getScript<Tile>("Tile");
@@ -296,7 +296,7 @@ void        NewBuild::triggerBuildableZone(const std::string &archetype)
             auto    tileTransform = turretBaseTile->getComponent<sTransformComponent>();
             auto    tileScriptComponent = turretBaseTile->getComponent<sScriptComponent>();
 
-            if (tileScriptComponent == nullptr || tileScriptComponent->enabled == false)
+            if (tileScriptComponent == nullptr || tileScriptComponent->isEnabled() == false)
                 continue;
 
             Tile*   tileScript = tileScriptComponent->getScript<Tile>("Tile");
@@ -442,7 +442,7 @@ void        NewBuild::updateSpawnersPaths(const glm::ivec2& tilePos)
             LOG_WARN("Can't find scriptComponent on Spawner entity");
             continue;
         }
-        if (!scriptComponent->enabled)
+        if (!scriptComponent->isEnabled())
             continue;
 
         auto spawnerScript = scriptComponent->getScript<Spawner>("Spawner");
@@ -485,7 +485,7 @@ void            NewBuild::updatePreview()
         auto    previewScripts = this->_preview->getComponent<sScriptComponent>();
 
         previewRenderer->ignoreRaycast = true;
-        previewScripts->enabled = false;
+        previewScripts->setEnabled(false);
     }
 }
 
@@ -187,7 +187,7 @@ void        CreditsState::setButton(Entity* buttonEntity, bool enabled)
         return;
     }
 
-    renderComponent->enabled = enabled;
-    uiComponent->enabled = enabled;
-    buttonComponent->enabled = enabled;
+    renderComponent->setEnabled(enabled);
+    uiComponent->setEnabled(enabled);
+    buttonComponent->setEnabled(enabled);
 }
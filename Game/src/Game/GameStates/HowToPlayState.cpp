@@ -193,7 +193,7 @@ void        HowToPlayState::setButton(Entity* buttonEntity, bool enabled)
         return;
     }
 
-    renderComponent->enabled = enabled;
-    uiComponent->enabled = enabled;
-    buttonComponent->enabled = enabled;
+    renderComponent->setEnabled(enabled);
+    uiComponent->setEnabled(enabled);
+    buttonComponent->setEnabled(enabled);
 }
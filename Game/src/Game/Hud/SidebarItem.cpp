@@ -44,7 +44,7 @@ void    SidebarItem::displayTextInfo(bool display)
         return;
     }
 
-    _infoRender->enabled = display;
+    _infoRender->setEnabled(display);
     // TODO: remove display from sRenderComponent and only used enabled
     _infoRender->display = display;
     _infoText->text.setContent(_description);
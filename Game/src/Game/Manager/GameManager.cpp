@@ -27,12 +27,21 @@ void GameManager::start()
             }
         }
     }
+
+    _projectileTag = EntityTags::getId("Projectile");
+
+    // Projectiles and explosions are created and destroyed every few frames
+    EntityFactory::enablePooling("FIRE_BALL", 32);
+    EntityFactory::enablePooling("PLAYER_BULLET", 32);
+    EntityFactory::enablePooling("TESLA_ORB", 8);
+    EntityFactory::enablePooling("ENEMY_EXPLOSION", 16);
+    EntityFactory::enablePooling("SPHERE_LASER_EXPLOSION", 8);
 }
 
 void GameManager::update(float dt)
 {
     EntityManager* em = EntityFactory::getBindedEntityManager();
-    const auto& projectiles = em->getEntitiesByTag("Projectile");
+    const auto& projectiles = em->getEntitiesByTag(_projectileTag);
     for (auto &projectile : projectiles)
     {
         sTransformComponent* transform = projectile->getComponent<sTransformComponent>();
@@ -52,9 +61,9 @@ void GameManager::displayMapParts(int part)
     for (auto& mapPart : mapParts)
     {
         auto render = mapPart->getComponent<sRenderComponent>();
-        render->enabled = true;
+        render->setEnabled(true);
         auto script = mapPart->getComponent<sScriptComponent>();
-        script->enabled = true;
+        script->setEnabled(true);
     }
 }
 
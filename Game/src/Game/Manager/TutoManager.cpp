@@ -212,7 +212,7 @@ void        TutoManager::display(bool displayed)
         sRenderComponent*   render = tutoManager->getComponent<sRenderComponent>();
 
         if (render != nullptr)
-            render->enabled = displayed;
+            render->setEnabled(displayed);
     }
 }
 
@@ -146,7 +146,7 @@ void            WaveManager::startWave(uint32_t wave)
             return;
         }
 
-        if (scriptComponent->enabled == true)
+        if (scriptComponent->isEnabled() == true)
             spawnerScript->triggerSpawnerConfigs(this->_currentWave);
     }
 }
@@ -207,7 +207,7 @@ bool            WaveManager::checkEndWave()
             continue;
         }
 
-        if (scriptComponent->enabled == false)
+        if (scriptComponent->isEnabled() == false)
             continue;
 
         auto    spawnerScript = scriptComponent->getScript<Spawner>("Spawner");
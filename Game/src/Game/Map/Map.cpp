@@ -68,6 +68,10 @@ void    Map::init()
     _entities.allocate(_width, _height);
     _towerslayer.allocate(_width, _height);
     _spawnersPaths.allocate(_width, _height);
+
+    // Gather the tiles by archetype so each archetype is instantiated in one batch
+    std::vector<glm::ivec2> floorCells;
+    std::vector<glm::ivec2> spawnerCells;
     for (int x = 0; x < _width; ++x)
     {
         for (int z = 0; z < _height; ++z)
@@ -75,42 +79,52 @@ void    Map::init()
             if ((*this)[x][z] == -1)
             {
                 // TODO: display other entity for castle pos ?
-                _entities[x][z] = EntityFactory::createEntity("TILE_FLOOR", glm::vec3(x * 25, 0, z * 25));
+                floorCells.push_back({x, z});
                 _castlePos = {x, z};
-                continue;
             }
-            if ((*this)[x][z] / LAYER_NUMBER == 0)
+            else if ((*this)[x][z] % LAYER_NUMBER == 1)
             {
-                if ((*this)[x][z] % LAYER_NUMBER == 1)
-                    _entities[x][z] = EntityFactory::createEntity("TILE_FLOOR", glm::vec3(x * 25, 0, z * 25));
-                else if ((*this)[x][z] % LAYER_NUMBER == 2)
-                    _entities[x][z] = EntityFactory::createEntity("SPAWNER", glm::vec3(x * 25, 0, z * 25));
+                floorCells.push_back({x, z});
             }
-            else
+            else if ((*this)[x][z] % LAYER_NUMBER == 2)
             {
-                Entity* entity = nullptr;
+                spawnerCells.push_back({x, z});
+            }
+        }
+    }
 
-                if ((*this)[x][z] % LAYER_NUMBER == 1)
-                {
-                    entity = EntityFactory::createEntity("TILE_FLOOR", glm::vec3(x * 25, 0, z * 25));
-                }
-                else if ((*this)[x][z] % LAYER_NUMBER == 2)
-                {
-                    entity = EntityFactory::createEntity("SPAWNER", glm::vec3(x * 25, 0, z * 25));
+    initCells("TILE_FLOOR", floorCells);
+    initCells("SPAWNER", spawnerCells);
+}
 
-                    entity->getComponent<sScriptComponent>()->enabled = false;
-                }
+void    Map::initCells(const std::string& typeName, const std::vector<glm::ivec2>& cells)
+{
+    std::vector<glm::vec3> positions;
+    positions.reserve(cells.size());
+    for (const auto& cell : cells)
+    {
+        positions.push_back(glm::vec3(cell.x * 25, 0, cell.y * 25));
+    }
 
-                if (!entity)
-                {
-                    continue;
-                }
+    std::vector<Entity*> entities = EntityFactory::createEntities(typeName, positions);
+    for (uint32_t i = 0; i < cells.size(); ++i)
+    {
+        int x = cells[i].x;
+        int z = cells[i].y;
+        Entity* entity = entities[i];
 
-                entity->getComponent<sRenderComponent>()->enabled = false;
+        _entities[x][z] = entity;
 
-                _entities[x][z] = entity;
-                _mapParts[(*this)[x][z] / LAYER_NUMBER].push_back(entity);
+        // The upper layers are hidden until their map part is displayed
+        if ((*this)[x][z] != -1 && (*this)[x][z] / LAYER_NUMBER != 0)
+        {
+            if ((*this)[x][z] % LAYER_NUMBER == 2)
+            {
+                entity->getComponent<sScriptComponent>()->setEnabled(false);
             }
+
+            entity->getComponent<sRenderComponent>()->setEnabled(false);
+            _mapParts[(*this)[x][z] / LAYER_NUMBER].push_back(entity);
         }
     }
 }
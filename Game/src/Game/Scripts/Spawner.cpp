@@ -2,6 +2,8 @@
 ** @Author : Simon AMBROISE
 */
 
+#include <algorithm>
+
 #include <Engine/Core/Components/Components.hh>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Debug/Debug.hpp>
@@ -60,7 +62,6 @@ void    Spawner::update(float deltaTime)
         {
             Spawner::sConfig*   waveConfig = *it;
 
-            waveConfig->updateSpawnedEntities();
             if (this->isActive() == true)
             {
                 bool    hasFinished = true;
@@ -491,6 +492,8 @@ Entity*    Spawner::spawnEntity(const std::string& entityName)
 
 void    Spawner::spawnEntitiesFromConfig(sConfig* waveConfig, float dt)
 {
+    auto    em = EntityFactory::getBindedEntityManager();
+
     for (Spawner::sConfig::sEntity& entity : waveConfig->spawnableEntities)
     {
         entity.elapsedTime += dt;
@@ -503,35 +506,30 @@ void    Spawner::spawnEntitiesFromConfig(sConfig* waveConfig, float dt)
             {
                 entity.elapsedTime = 0.0f;
                 entity.amountSpawned++;
+
+                waveConfig->spawnedEntities.push_back(spawnedEntity->handle);
+                //  The observer is dropped if the Spawner is destroyed first
+                em->observeEntityDestroyed(spawnedEntity->handle, [waveConfig](const Entity::sHandle& entityHandle) {
+                    waveConfig->onSpawnedEntityDestroyed(entityHandle);
+                }, this->entity->handle);
             }
             else
                 LOG_ERROR("Could not spawn entity from config \"%s\"", entity.name);
-
-            waveConfig->spawnedEntities.push_back(spawnedEntity->handle);
         }
     }
 }
 
 /**
     This function updates the 'spawned entities' pool of a config by
-    removing the entities' ids by checking if they still exist in
-    the EntityManager or not.
+    removing the id of an entity destroyed by the EntityManager.
+    It is called by the observer subscribed when the entity is spawned.
 */
-void    Spawner::sConfig::updateSpawnedEntities()
+void    Spawner::sConfig::onSpawnedEntityDestroyed(const Entity::sHandle& entityHandle)
 {
-    auto    em = EntityFactory::getBindedEntityManager();
-    auto   it = spawnedEntities.begin();
-
-    for (it; it != spawnedEntities.end();)
-    {
-        Entity::sHandle    entityHandle = *it;
+    auto   it = std::find(spawnedEntities.begin(), spawnedEntities.end(), entityHandle);
 
-        //  The entity of the wave config is dead
-        if (em->getEntity(entityHandle) == nullptr)
-            it = spawnedEntities.erase(it);
-        else
-            ++it;
-    }
+    if (it != spawnedEntities.end())
+        spawnedEntities.erase(it);
 }
 
 bool    Spawner::sConfig::areAllEntitiesSpawned()
@@ -7,9 +7,11 @@
 #include <Game/Character/Enemy.hpp>
 #include <Game/Trap/Trap.hpp>
 
+Trap::Trap(): _enemyTag(EntityTags::getId(ENEMY_TAG)) {}
+
 void Trap::onCollisionEnter(Entity* entity)
 {
-    if (entity->getTag() == "Enemy")
+    if (entity->hasTag(_enemyTag))
     {
         sScriptComponent* script = entity->getComponent<sScriptComponent>();
         Enemy* enemy = script ? script->getScript<Enemy>("Enemy") : nullptr;
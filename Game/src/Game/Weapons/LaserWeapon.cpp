@@ -20,6 +20,7 @@ LaserWeapon::LaserWeapon()
 
     _shootSound = EventSound::getEventByEventType(eEventSound::PLAYER_SHOOT_LAZR);
     _material = ResourceManager::getInstance()->getResource<Material>("weapon_laser.mat");
+    _enemyTag = EntityTags::getId(ENEMY_TAG);
 }
 
 void    LaserWeapon::fire(Player* player, sTransformComponent* playerTransform, sRenderComponent* playerRender, glm::vec3 playerDirection)
@@ -56,7 +57,7 @@ void    LaserWeapon::sortHitedEntities(sTransformComponent* playerTransform, std
 
     for (auto& entity : entities)
     {
-        if (entity->getTag() != "Enemy")
+        if (!entity->hasTag(_enemyTag))
             distance = glm::distance(entity->getComponent<sTransformComponent>()->getPos(), playerTransform->getPos());
     }
 
@@ -114,7 +115,7 @@ void LaserWeapon::fireMultipleEnemy(Player* player, sTransformComponent* playerT
 
         for (auto hitedEntity : hitedEntities)
         {
-            if (hitedEntity != nullptr && hitedEntity->getTag() == "Enemy")
+            if (hitedEntity != nullptr && hitedEntity->hasTag(_enemyTag))
             {
                 auto entityScriptComponent = hitedEntity->getComponent<sScriptComponent>();
                 if (entityScriptComponent == nullptr)
@@ -158,7 +159,7 @@ void LaserWeapon::fireOneEnemy(Player* player, sTransformComponent* playerTransf
             this->_laser->getComponent<sTransformComponent>()->setScale(glm::vec3{ 0.2f, glm::distance(hitedEntity->getComponent<sTransformComponent>()->getPos(), playerTransform->getPos()) / SIZE_UNIT, 0.2f });
             this->_laser->getComponent<sTransformComponent>()->setRotation(glm::vec3(90.0f, playerTransform->getRotation().y, 0.0f));
 
-            if (hitedEntity->getTag() == "Enemy")
+            if (hitedEntity->hasTag(_enemyTag))
             {
                 auto entityScriptComponent = hitedEntity->getComponent<sScriptComponent>();
                 if (entityScriptComponent == nullptr)
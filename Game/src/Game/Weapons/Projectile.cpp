@@ -14,36 +14,31 @@ REGISTER_SCRIPT(Projectile);
 void Projectile::start()
 {
     _targetHandle = 0;
+    _target = nullptr;
+    _targetObserver = 0;
     _projectileTransform = entity->getComponent<sTransformComponent>();
     _projectileCollider = entity->getComponent<sSphereColliderComponent>();
     _projectileRigidBody = entity->getComponent<sRigidBodyComponent>();
     _projectileEmitter = entity->getComponent<sParticleEmitterComponent>();
     _speed = 150.0f;
+    _enemyTag = EntityTags::getId(ENEMY_TAG);
+    _tileWallTag = EntityTags::getId("TileWall");
+    _tileBaseTurretTag = EntityTags::getId("TileBaseTurret");
 }
 
 void Projectile::update(float dt)
 {
-    if (!_targetHandle)
+    if (!_target)
     {
         return;
     }
 
-    EntityManager* em = EntityFactory::getBindedEntityManager();
-    Entity* target = em->getEntity(_targetHandle);
-    if (!target)
-    {
-        //LOG_INFO("No target");
-        destroyProjectile();
-    }
-    else
-    {
-        followTarget(target);
-    }
+    followTarget(_target);
 }
 
 void Projectile::onCollisionEnter(Entity* entity)
 {
-    if (entity->handle == _targetHandle || entity->getTag() == "Enemy")
+    if (entity->handle == _targetHandle || entity->hasTag(_enemyTag))
     {
         sScriptComponent* script = entity->getComponent<sScriptComponent>();
         Enemy* enemy = script ? script->getScript<Enemy>("Enemy") : nullptr;
@@ -57,13 +52,26 @@ void Projectile::onCollisionEnter(Entity* entity)
         enemy->takeDamage(_damage);
         destroyProjectile();
     }
-    else if (entity->getTag() == "TileWall" ||
-            entity->getTag() == "TileBaseTurret")
+    else if (entity->hasTag(_tileWallTag) ||
+            entity->hasTag(_tileBaseTurretTag))
     {
         destroyProjectile();
     }
 }
 
+void Projectile::setTarget(Entity* target)
+{
+    EntityManager* em = EntityFactory::getBindedEntityManager();
+
+    _target = target;
+    _targetHandle = target->handle;
+    // The observer is dropped if the projectile is destroyed first
+    _targetObserver = em->observeEntityDestroyed(_targetHandle, [this](const Entity::sHandle& handle) {
+        _target = nullptr;
+        destroyProjectile();
+    }, entity->handle);
+}
+
 void Projectile::followTarget(Entity* target)
 {
     sTransformComponent* targetTransform = target->getComponent<sTransformComponent>();
@@ -78,7 +86,14 @@ void Projectile::followDirection(const glm::vec3& dir)
 
 void Projectile::destroyProjectile()
 {
+    if (_targetObserver)
+    {
+        EntityFactory::getBindedEntityManager()->removeObserver(_targetHandle, _targetObserver);
+        _targetObserver = 0;
+    }
+
     _targetHandle = 0;
+    _target = nullptr;
     // Set a low emitter life instead of destroying the entity
     _projectileEmitter->emitterLife = 0.001f;
     _projectileRigidBody->collisionsEnabled = false;
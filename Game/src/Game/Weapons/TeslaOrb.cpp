@@ -16,6 +16,7 @@ void        TeslaOrb::start()
     this->_rigidBody = this->getComponent<sRigidBodyComponent>();
     this->_speed = new Attribute(100.0f);
     this->_range = new Attribute(150.0f);
+    this->_tileBaseTurretTag = EntityTags::getId("TileBaseTurret");
 
     if (render != nullptr)
         render->_animator.play("spinning");
@@ -32,7 +33,7 @@ void        TeslaOrb::update(float deltaTime)
 
 void        TeslaOrb::onCollisionEnter(Entity* entity)
 {
-    if (entity->getTag() == "TileBaseTurret")
+    if (entity->hasTag(this->_tileBaseTurretTag))
     {
         LOG_DEBUG("Captain Amari says: ALLEZ NANOBOOST MON GARS SUR.");
         this->Destroy();
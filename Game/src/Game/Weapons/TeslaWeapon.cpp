@@ -26,6 +26,7 @@ TeslaWeapon::TeslaWeapon()
 
     _shootSound = EventSound::getEventByEventType(eEventSound::PLAYER_SHOOT_ELEC);
     _material = ResourceManager::getInstance()->getResource<Material>("weapon_tesla.mat");
+    _enemyTag = EntityTags::getId(ENEMY_TAG);
 }
 
 void    TeslaWeapon::fire(Player* player, sTransformComponent* playerTransform, sRenderComponent* playerRender, glm::vec3 playerDirection)
@@ -89,7 +90,7 @@ void    TeslaWeapon::fireLightning(Player* player, sTransformComponent* playerTr
     raycastHit = Ray(playerPos, glm::vec3{ playerDirection.x, 0.0f, playerDirection.z });
 
     if (Physics::raycast(raycastHit, &hitEntity, std::vector<Entity*> { player->getEntity() }) == true &&
-        hitEntity->getTag() == "Enemy")
+        hitEntity->hasTag(_enemyTag))
     {
         this->spreadLightning(hitEntity, this->_attributes["HitAmount"]->getFinalValue());
     }
@@ -100,7 +101,7 @@ void    TeslaWeapon::spreadLightning(Entity* hitEntity, unsigned int hitLeft, st
     if (hitLeft > 0)
     {
         auto    em = EntityFactory::getBindedEntityManager();
-        auto&   enemies = em->getEntitiesByTag("Enemy");
+        auto&   enemies = em->getEntitiesByTag(_enemyTag);
 
         float   nearestDistance = std::numeric_limits<float>::max();
         Entity* nearestEntity = nullptr;
@@ -4,10 +4,15 @@
 
 #pragma comment(linker, "/SUBSYSTEM:windows /ENTRY:mainCRTStartup")
 
+#include <cctype>
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <Engine/BasicState.hpp>
 #include <Engine/Core/Engine.hpp>
+#include <Engine/Core/Headless.hpp>
 #include <Engine/EntityFactory.hpp>
 #include <Engine/Utils/Exception.hpp>
 #include <Engine/Utils/EventSound.hpp>
@@ -15,6 +20,7 @@
 #include <Engine/Debug/Logger.hpp>
 #include <Engine/Utils/ResourceManager.hpp>
 #include <Engine/Debug/Debug.hpp>
+#include <Engine/Debug/Profiler.hpp>
 
 #include <Game/GameStates/ConfirmBackToMenuState.hpp>
 #include <Game/GameStates/ConfirmExitState.hpp>
@@ -42,12 +48,66 @@ void    windowCloseHandler(void* data)
     }
 }
 
+struct sOptions
+{
+    // Arguments left to the engine (level name in debug mode...)
+    std::vector<char*>  engineArgs;
+    std::string         recordFileName;
+    std::string         replayFileName;
+};
+
+static bool isNumber(const char* arg)
+{
+    return (std::isdigit(static_cast<unsigned char>(arg[0])) != 0);
+}
+
+/*
+** --headless [ticks per second] [ticks limit]
+**      The ticks per second default to 0 (maximum speed) and the ticks limit to 0 (no limit)
+** --record <file>
+**      Record the input, the frames elapsed time and the random seed
+** --replay <file>
+**      Replay a recorded session, the engine stops at the end of the record
+** --profile <frames>
+**      Record the number of frames with the profiler and dump the trace in profile.json (F12 records 300 frames)
+*/
+static void parseOptions(int ac, char** av, Engine& engine, sOptions& options)
+{
+    options.engineArgs.push_back(av[0]);
+    for (int i = 1; i < ac; ++i)
+    {
+        std::string arg = av[i];
+
+        if (arg == "--headless")
+        {
+            Headless::setEnabled(true);
+            engine.getFramePacer().setTargetFps(0.0f);
+
+            if (i + 1 < ac && isNumber(av[i + 1]))
+                engine.getFramePacer().setTargetFps((float)std::atof(av[++i]));
+            if (i + 1 < ac && isNumber(av[i + 1]))
+                Headless::setTicksLimit((uint32_t)std::strtoul(av[++i], nullptr, 10));
+        }
+        else if (arg == "--record" && i + 1 < ac)
+            options.recordFileName = av[++i];
+        else if (arg == "--replay" && i + 1 < ac)
+            options.replayFileName = av[++i];
+        else if (arg == "--profile" && i + 1 < ac && isNumber(av[i + 1]))
+            Profiler::captureFrames((uint32_t)std::strtoul(av[++i], nullptr, 10));
+        else
+            options.engineArgs.push_back(av[i]);
+    }
+    options.engineArgs.push_back(nullptr);
+}
+
 int     main(int ac, char** av)
 {
     Engine engine;
     auto &&gameStateManager = engine.getGameStateManager();
+    sOptions options;
     try
     {
+        parseOptions(ac, av, engine, options);
         if (!engine.init())
             return (1);
 
@@ -83,10 +143,30 @@ int     main(int ac, char** av)
         //  if (!engine.run(ac, av, playState))
         //      return (1);
 
-        std::shared_ptr<LogoState>    digipenLogoState = std::make_shared<LogoState>(&gameStateManager);
-
-        if (!engine.run(ac, av, digipenLogoState))
+        // Start the record or the replay after the resources loading, they use the window size
+        auto& inputRecorder = engine.getInputRecorder();
+        if ((!options.recordFileName.empty() && !inputRecorder.startRecording(options.recordFileName)) ||
+            (!options.replayFileName.empty() && !inputRecorder.startReplay(options.replayFileName)))
             return (1);
+
+        int engineAc = (int)options.engineArgs.size() - 1;
+        char** engineAv = options.engineArgs.data();
+
+        // The menus wait for inputs, the headless mode directly plays the game
+        if (Headless::isEnabled())
+        {
+            std::shared_ptr<PlayState> playState = std::make_shared<PlayState>(&gameStateManager);
+
+            if (!engine.run(engineAc, engineAv, playState))
+                return (1);
+        }
+        else
+        {
+            std::shared_ptr<LogoState>    digipenLogoState = std::make_shared<LogoState>(&gameStateManager);
+
+            if (!engine.run(engineAc, engineAv, digipenLogoState))
+                return (1);
+        }
     }
     catch (const std::exception& e)
     {